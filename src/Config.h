@@ -1,5 +1,6 @@
 // src\Config.h -- user configuration
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include "Tool/Schema.h"
 
 /**
  * @brief Data configuration for bit packing or unpacking
@@ -20,6 +21,7 @@
  *   - Packing efficiency increases for narrow value ranges, as they require fewer bits, while expanding the range increases the required number of bits logarithmically.
  *     The smaller the spread of values, the more compact the packing: halving the range reduces the required number of bits by 1, and increasing by 1 bit allows storing twice as many unique values.
  *   - For values 0-127, Varint encoding is preferable.
+ *   - Channels with different ranges should be described by a schema, so each one takes only its own bits.
  */
 namespace Config {
     /**
@@ -42,4 +44,12 @@ namespace Config {
      * @brief Maximum value of an element (inclusive)
      */
     constexpr unsigned int maximum = 1000;
+
+    /**
+     * @brief Range of every element, one Tool::Field per element
+     * @details By default all amount elements share [minimal, maximum].
+     *          Heterogeneous example, hours/minutes/seconds in 5/6/6 bits and a timer in 10 bits:
+     *          using schema = Tool::Schema< Tool::Field< 0, 23 >, Tool::Field< 0, 59 >, Tool::Field< 0, 59 >, Tool::Field< 0, 1000 > >;
+     */
+    using schema = Tool::UniformSchema< amount, minimal, maximum >;
 } // namespace Config
\ No newline at end of file
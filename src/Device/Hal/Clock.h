@@ -0,0 +1,26 @@
+// src\Device\Hal\Clock.h - time and sleep for drivers, a host model replaces it in native tests
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <stdint.h>
+#include "Device/SysTick.h"
+
+namespace Device::Hal {
+/**
+ * @class Clock
+ * @brief Milliseconds of SysTick and sleeping until the next interrupt
+ */
+struct Clock {
+    /// Milliseconds since Device::SysTick::init_millis()
+    static uint32_t millis() {
+        return ::millis( );
+    }
+
+    /**
+     * @brief Sleep until any interrupt
+     * @details SysTick wakes the core at least every millisecond,
+     *          so an event missed right before the call delays the waiter by 1 ms at most.
+     */
+    static void idle() {
+        __asm__ __volatile__( "wfi" );
+    }
+};
+} // namespace Device::Hal
@@ -0,0 +1,42 @@
+// src\Device\Hal\Crc.h - CRC unit access for hashers, a host model replaces it in native tests
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <libopencm3/stm32/crc.h>
+#include <libopencm3/stm32/rcc.h>
+#include <stdint.h>
+
+namespace Device::Hal {
+/**
+ * @class Crc
+ * @brief STM32 CRC unit: CRC-32 (poly 0x04C11DB7, init 0xFFFFFFFF) over 32-bit words
+ */
+struct Crc {
+    static void begin() {
+        rcc_periph_clock_enable( RCC_CRC );
+    }
+
+    /// Data register to the initial value
+    static void reset() {
+        crc_reset( );
+    }
+
+    /// Feed one word, returns the CRC so far
+    static uint32_t write(uint32_t word) {
+        return crc_calculate( word );
+    }
+
+    /// Feed words, returns the CRC so far
+    static uint32_t write(const uint32_t *words, size_t count) {
+        return crc_calculate_block( const_cast< uint32_t *>( words ), count );
+    }
+
+    /// CRC so far
+    static uint32_t read() {
+        return CRC_DR;
+    }
+
+    /// Address of the data register, destination of DMA
+    static uintptr_t dataAddress() {
+        return reinterpret_cast< uintptr_t >( &CRC_DR );
+    }
+};
+} // namespace Device::Hal
@@ -0,0 +1,152 @@
+// src\Device\Hal\Dma.h - DMA1 channel access for drivers, a host model replaces it in native tests
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/cm3/nvic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Hardware abstraction of the peripherals used by the drivers
+ * @details Drivers take these policies as template parameters, all functions are static and inline,
+ *          so the target code is the same as with direct libopencm3 calls.
+ *          Native tests pass register models from test/native/Model with the same interface.
+ */
+namespace Device::Hal {
+/**
+ * @class DmaChannel
+ * @brief One channel of DMA1
+ * @tparam Channel Channel number, 1..7
+ */
+template<uint8_t Channel>
+struct DmaChannel {
+    static constexpr uint8_t k_channel = Channel;
+
+    /// DMA1 clock and the channel interrupt
+    static void begin(uint8_t priority) {
+        rcc_periph_clock_enable( RCC_DMA1 );
+        nvic_set_priority( irq( ), priority );
+        nvic_enable_irq( irq( ) );
+    }
+
+    /**
+     * @brief Memory-to-memory copy of 32-bit words into a fixed register
+     * @param source Word-aligned source buffer
+     * @param destination Address of the register, not incremented
+     * @param count Number of words
+     */
+    static void startWordsToRegister(const void *source, uintptr_t destination, size_t count) {
+        stop( );
+        dma_channel_reset( DMA1, Channel );
+        // In mem2mem mode the "peripheral" side is the incrementing source
+        dma_set_peripheral_address( DMA1, Channel, reinterpret_cast< uintptr_t >( source ) );
+        dma_set_memory_address( DMA1, Channel, destination );
+        dma_set_read_from_peripheral( DMA1, Channel );
+        dma_enable_peripheral_increment_mode( DMA1, Channel );
+        dma_set_peripheral_size( DMA1, Channel, DMA_CCR_PSIZE_32BIT );
+        dma_set_memory_size( DMA1, Channel, DMA_CCR_MSIZE_32BIT );
+        dma_enable_mem2mem_mode( DMA1, Channel );
+        start( count );
+    }
+
+    /**
+     * @brief Bytes from memory to a peripheral data register, one shot
+     * @param source Source buffer
+     * @param peripheral Address of the data register
+     * @param count Number of bytes
+     */
+    static void startToPeripheral(const void *source, uintptr_t peripheral, size_t count) {
+        stop( );
+        dma_channel_reset( DMA1, Channel );
+        dma_set_peripheral_address( DMA1, Channel, peripheral );
+        dma_set_memory_address( DMA1, Channel, reinterpret_cast< uintptr_t >( source ) );
+        dma_set_read_from_memory( DMA1, Channel );
+        dma_enable_memory_increment_mode( DMA1, Channel );
+        dma_set_peripheral_size( DMA1, Channel, DMA_CCR_PSIZE_8BIT );
+        dma_set_memory_size( DMA1, Channel, DMA_CCR_MSIZE_8BIT );
+        start( count );
+    }
+
+    /**
+     * @brief Bytes from a peripheral data register to memory
+     * @param peripheral Address of the data register
+     * @param destination Destination buffer
+     * @param count Number of bytes
+     * @param circular Restart from the beginning of the buffer after the last byte
+     */
+    static void startFromPeripheral(uintptr_t peripheral, volatile void *destination, size_t count, bool circular) {
+        stop( );
+        dma_channel_reset( DMA1, Channel );
+        dma_set_peripheral_address( DMA1, Channel, peripheral );
+        dma_set_memory_address( DMA1, Channel, reinterpret_cast< uintptr_t >( destination ) );
+        dma_set_read_from_peripheral( DMA1, Channel );
+        dma_enable_memory_increment_mode( DMA1, Channel );
+        dma_set_peripheral_size( DMA1, Channel, DMA_CCR_PSIZE_8BIT );
+        dma_set_memory_size( DMA1, Channel, DMA_CCR_MSIZE_8BIT );
+        if ( circular )
+            dma_enable_circular_mode( DMA1, Channel );
+        start( count );
+    }
+
+    /// Interrupt also on the half of the transfer, after the start
+    static void enableHalfInterrupt() {
+        dma_enable_half_transfer_interrupt( DMA1, Channel );
+    }
+
+    /// Hold the channel interrupt back, the flags stay pending
+    static void maskIrq() {
+        nvic_disable_irq( irq( ) );
+    }
+    static void unmaskIrq() {
+        nvic_enable_irq( irq( ) );
+    }
+
+    /// Raise the channel interrupt by software, e.g. to start the next transfer from the handler
+    static void pend() {
+        nvic_set_pending_irq( irq( ) );
+    }
+
+    /// Disable the channel, the transfer is abandoned
+    static void stop() {
+        dma_disable_channel( DMA1, Channel );
+    }
+
+    /// Units left to transfer (CNDTR), reloaded in circular mode
+    static size_t remaining() {
+        return dma_get_number_of_data( DMA1, Channel );
+    }
+
+    static bool isHalf() {
+        return dma_get_interrupt_flag( DMA1, Channel, DMA_HTIF );
+    }
+    static bool isComplete() {
+        return dma_get_interrupt_flag( DMA1, Channel, DMA_TCIF );
+    }
+    static bool isError() {
+        return dma_get_interrupt_flag( DMA1, Channel, DMA_TEIF );
+    }
+    static void clearHalf() {
+        dma_clear_interrupt_flags( DMA1, Channel, DMA_HTIF );
+    }
+    static void clearComplete() {
+        dma_clear_interrupt_flags( DMA1, Channel, DMA_TCIF );
+    }
+    static void clearError() {
+        dma_clear_interrupt_flags( DMA1, Channel, DMA_TEIF );
+    }
+
+private:
+    static void start(size_t count) {
+        dma_set_number_of_data( DMA1, Channel, count );
+        dma_clear_interrupt_flags( DMA1, Channel, DMA_GIF );
+        dma_enable_transfer_complete_interrupt( DMA1, Channel );
+        dma_enable_transfer_error_interrupt( DMA1, Channel );
+        dma_enable_channel( DMA1, Channel );
+    }
+
+    static constexpr uint8_t irq() {
+        // NVIC_DMA1_CHANNEL1_IRQ .. NVIC_DMA1_CHANNEL7_IRQ are consecutive
+        return NVIC_DMA1_CHANNEL1_IRQ + Channel - 1;
+    }
+};
+} // namespace Device::Hal
@@ -0,0 +1,62 @@
+// src\Device\Hal\Spi.h - SPI2 access for SpiDma, a host model replaces it in native tests
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <libopencm3/stm32/gpio.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/spi.h>
+#include <stdint.h>
+
+namespace Device::Hal {
+/**
+ * @class Spi2
+ * @brief SPI2 master on PB12 (NSS), PB13 (SCK), PB14 (MISO), PB15 (MOSI), mode 0, 8 bit, MSB first
+ * @details Data moves by DMA only: RX on DMA1 channel 4, TX on DMA1 channel 5.
+ *          SPI1 would take channels 2 and 3, they belong to USART3.
+ */
+struct Spi2 {
+    static constexpr uint32_t k_spi = SPI2;
+
+    /// Clocks, pins and the mode once, DMA requests enabled
+    static void begin() {
+        rcc_periph_clock_enable( RCC_GPIOB );
+        rcc_periph_clock_enable( RCC_SPI2 );
+
+        // SCK, MOSI
+        gpio_set_mode( GPIOB, GPIO_MODE_OUTPUT_50_MHZ, GPIO_CNF_OUTPUT_ALTFN_PUSHPULL, GPIO13 | GPIO15 );
+        // MISO
+        gpio_set_mode( GPIOB, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, GPIO14 );
+        // NSS driven around each transfer
+        gpio_set_mode( GPIOB, GPIO_MODE_OUTPUT_50_MHZ, GPIO_CNF_OUTPUT_PUSHPULL, GPIO12 );
+        deselect( );
+
+        // APB1 36 MHz / 4, the 9 MHz of the former SPI1 / 8
+        spi_init_master( k_spi, SPI_CR1_BAUDRATE_FPCLK_DIV_4,
+                        SPI_CR1_CPOL_CLK_TO_0_WHEN_IDLE,
+                        SPI_CR1_CPHA_CLK_TRANSITION_1,
+                        SPI_CR1_DFF_8BIT, SPI_CR1_MSBFIRST );
+        // The NSS pin is a GPIO, the master mode must not depend on it
+        spi_enable_software_slave_management( k_spi );
+        spi_set_nss_high( k_spi );
+        spi_enable_rx_dma( k_spi );
+        spi_enable_tx_dma( k_spi );
+        spi_enable( k_spi );
+    }
+
+    static void select() {
+        gpio_clear( GPIOB, GPIO12 );
+    }
+    static void deselect() {
+        gpio_set( GPIOB, GPIO12 );
+    }
+
+    /// Drop a byte left in the data register, RX DMA would take it first
+    static void discard() {
+        (void)SPI_DR( k_spi );
+        (void)SPI_SR( k_spi );
+    }
+
+    /// Address of the data register, source and destination of DMA
+    static uintptr_t dataAddress() {
+        return reinterpret_cast< uintptr_t >( &SPI_DR( k_spi ) );
+    }
+};
+} // namespace Device::Hal
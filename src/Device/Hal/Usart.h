@@ -0,0 +1,74 @@
+// src\Device\Hal\Usart.h - USART3 access for HardwareUART, a host model replaces it in native tests
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <libopencm3/stm32/gpio.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/usart.h>
+#include <libopencm3/cm3/nvic.h>
+#include <stdint.h>
+
+namespace Device::Hal {
+/**
+ * @class Usart3
+ * @brief USART3 on PC10 (TX) and PC11 (RX), partial remap, 8E2
+ * @details Data moves by DMA only: RX on DMA1 channel 3, TX on DMA1 channel 2.
+ */
+struct Usart3 {
+    static constexpr uint32_t k_usart = USART3;
+
+    /**
+     * @brief Clocks, pins and the frame format, DMA requests enabled
+     * @param baud Baud rate
+     */
+    static void begin(uint32_t baud) {
+        usart_disable( k_usart );
+        rcc_periph_clock_enable( RCC_AFIO );
+        rcc_periph_clock_enable( RCC_GPIOC );
+        rcc_periph_clock_enable( RCC_USART3 );
+
+        gpio_primary_remap( AFIO_MAPR_SWJ_CFG_FULL_SWJ, AFIO_MAPR_USART3_REMAP_PARTIAL_REMAP );
+        // TX
+        gpio_set_mode( GPIOC, GPIO_MODE_OUTPUT_50_MHZ, GPIO_CNF_OUTPUT_ALTFN_PUSHPULL, GPIO10 );
+        // RX
+        gpio_set_mode( GPIOC, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, GPIO11 );
+
+        // 8E2 mode
+        usart_set_baudrate( k_usart, baud );
+        // 8 data bits + 1 parity bit
+        usart_set_databits( k_usart, 9 );
+        // 2 stop bits
+        usart_set_stopbits( k_usart, USART_STOPBITS_2 );
+        // Even parity
+        usart_set_parity( k_usart, USART_PARITY_EVEN );
+        usart_set_mode( k_usart, USART_MODE_TX_RX );
+        usart_set_flow_control( k_usart, USART_FLOWCONTROL_NONE );
+        usart_enable_rx_dma( k_usart );
+        usart_enable_tx_dma( k_usart );
+        usart_enable( k_usart );
+    }
+
+    /**
+     * @brief Interrupt when the line goes idle after a received byte, i.e. at the end of a message
+     * @param priority NVIC priority of the USART interrupt
+     */
+    static void enableIdleInterrupt(uint8_t priority) {
+        USART_CR1( k_usart ) |= USART_CR1_IDLEIE;
+        nvic_set_priority( NVIC_USART3_IRQ, priority );
+        nvic_enable_irq( NVIC_USART3_IRQ );
+    }
+
+    static bool isIdle() {
+        return USART_SR( k_usart ) & USART_SR_IDLE;
+    }
+
+    /// SR then DR read, DMA has already taken the data so nothing is lost
+    static void clearIdle() {
+        (void)USART_SR( k_usart );
+        (void)USART_DR( k_usart );
+    }
+
+    /// Address of the data register, source and destination of DMA
+    static uintptr_t dataAddress() {
+        return reinterpret_cast< uintptr_t >( &USART_DR( k_usart ) );
+    }
+};
+} // namespace Device::Hal
@@ -0,0 +1,24 @@
+// src\Device\HardwareUART.cpp - interrupt vectors of HardwareUART
+// Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include "Device/HardwareUART.h"
+
+/**
+ * @brief DMA1 channel 3 interrupt handler, USART3 RX
+ */
+extern "C" void dma1_channel3_isr(void) {
+    Device::HardwareUART::rxIsr( );
+}
+
+/**
+ * @brief DMA1 channel 2 interrupt handler, USART3 TX
+ */
+extern "C" void dma1_channel2_isr(void) {
+    Device::HardwareUART::txIsr( );
+}
+
+/**
+ * @brief USART3 interrupt handler, line idle
+ */
+extern "C" void usart3_isr(void) {
+    Device::HardwareUART::usartIsr( );
+}
@@ -1,173 +1,283 @@
-// src\Device\HardwareUART.h - could be split into several classes and enable DMA mode separately, but there was not enough time
+// src\Device\HardwareUART.h - UART with DMA in both directions, the reception strategies are in Device/Uart
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
-#include <libopencm3/stm32/dma.h>
-#include <libopencm3/stm32/gpio.h>
-#include <libopencm3/stm32/rcc.h>
-#include <libopencm3/stm32/usart.h>
-#include <libopencm3/cm3/nvic.h>
-#include <libopencm3/cm3/cortex.h>
 #include <stddef.h>
-#include <type_traits>
-#include "Serialization/Config/DataFormat.h"
-#include "Serialization/Config/Hashing.h"
+#include <stdint.h>
+#include "Device/Uart/RingReceiver.h"
+#include "Device/Uart/PingPongReceiver.h"
+#include "Serialization/Config/Frame.h"
+#include "Tool/Segment.h"
+#include "Tool/SpscRing.h"
+#if defined( __arm__ )
+#include "Device/Hal/Clock.h"
+#include "Device/Hal/Dma.h"
+#include "Device/Hal/Usart.h"
+#endif
 
 namespace Device {
 /**
- * @brief Class for working with UART (USART3) on pins PC10 (RX) and PC11 (TX)
+ * @brief Class for working with UART through DMA in both directions
+ * @tparam Usart USART policy, Hal::Usart3 or a host model
+ * @tparam RxDma DMA channel of the USART RX request
+ * @tparam TxDma DMA channel of the USART TX request
+ * @tparam Clock Milliseconds and sleep, Hal::Clock or a host model
+ * @tparam Receiver RX strategy: Uart::RingReceiver for any message length, Uart::PingPongReceiver for fixed frames
  * @note Implementation via registers, without using HAL/LL
- * @note With DMA and circular buffer
+ * @note Non-blocking RX comes from the Receiver: available(), tryRead(), tryConsume(), overruns().
+ *       Waiting ones sleep between interrupts: readBytes(), readFor(), consume(), consumeFor(),
+ *       poll() dispatches frames to a registered handler from a super-loop.
+ * @note write() and writev() queue the bytes and return, DMA sends them in the background
  */
-class HardwareUART {
-    /// Pointer to USART3 registers
-    const uint32_t k_usart = USART3;
+template<typename Usart, typename RxDma, typename TxDma, typename Clock, template<typename, typename> class Receiver = Uart::RingReceiver>
+class HardwareUARTTpl : public Receiver< Usart, RxDma > {
+    using Rx = Receiver< Usart, RxDma >;
+    /// Frame of the fixed-size format
+    static constexpr size_t k_frameSize = Serialization::detail_::k_frameSize;
 
-    /// DMA buffer size
-    static constexpr uint32_t k_DmaBufferSize = 0 
-        + sizeof( Serialization::detail_::HashReturnType ) 
-        + sizeof( Serialization::detail_::PackedData );
+public:
+    /// Handler of a received frame, runs in poll()
+    using FrameHandler = void(*)(const uint8_t *frame, size_t length, void *context);
+    /// Handler of the silence on the line, runs in poll()
+    using SilenceHandler = void(*)(void *context);
 
-    /// Hardware DMA buffer, filled automatically
-    inline static volatile uint8_t dma_buf[k_DmaBufferSize] = { };
+private:
+    FrameHandler m_onFrame = nullptr;
+    SilenceHandler m_onSilence = nullptr;
+    void *m_context = nullptr;
+    uint32_t m_timeout = 0;
+    /// Time of the last frame or silence report
+    uint32_t m_last = 0;
 
-    /**
-     * @brief Data ready flag
-     * @warning Requires atomic access. Only write in interrupt, only read in main loop.
-     * @details Set to true when DMA buffer is full (TCIF interrupt).
-     *          Reset to false after reading data.
-     */
-    inline static volatile bool data_ready = false;
+public:
+    /// TX queue size, power of two, holds several frames
+    static constexpr size_t k_TxQueueSize = 256;
+
+private:
+    /// Bytes waiting for TX DMA, write() produces, the TX interrupt consumes in place
+    inline static Tool::SpscRing< uint8_t, k_TxQueueSize > tx_queue;
+    /// Bytes of the running DMA transfer, 0 if idle, used only by the TX interrupt
+    inline static size_t tx_chunk = 0;
+
+public:
+    /// Buffer of one frame for convenience
+    using Buffer = uint8_t[k_frameSize];
 
     /**
-     * @brief DMA interrupt handler, circular mode
-     * @note Assume CNDTR is always equal to k_DmaBufferSize on entry
+     * @brief DMA interrupt handler of TX
+     * @details Transfers start only here: on completion of the previous one
+     *          and on the software-raised interrupt from write(), so no race with the main loop.
      */
-    __attribute__((__used__)) static void DMA1_Channel3_IRQHandler() {
-        // Ignore errors
-        if (dma_get_interrupt_flag(DMA1, DMA_CHANNEL3, DMA_TEIF)) {
-            dma_clear_interrupt_flags(DMA1, DMA_CHANNEL3, DMA_TEIF);
-            return;
+    static void txIsr() {
+        // The channel is disabled by hardware, the piece is dropped
+        if (TxDma::isError()) {
+            TxDma::clearError();
+            tx_queue.release(tx_chunk);
+            tx_chunk = 0;
         }
-        if (dma_get_interrupt_flag(DMA1, DMA_CHANNEL3, DMA_TCIF)) {
-            dma_clear_interrupt_flags(DMA1, DMA_CHANNEL3, DMA_TCIF);
-            /*
-             * In circular mode:
-             * - Interrupt occurs when buffer is completely filled
-             * - CNDTR is ALREADY reloaded to k_DmaBufferSize at this point
-             * - Do not use CNDTR to calculate position!
-             */
-            data_ready = true;
+        if (TxDma::isComplete()) {
+            TxDma::clearComplete();
+            tx_queue.release(tx_chunk);
+            tx_chunk = 0;
         }
+        // Next contiguous piece of the queue
+        const uint8_t *data;
+        if ( !tx_chunk && ( tx_chunk = tx_queue.readable( &data ) ) )
+            TxDma::startToPeripheral( data, Usart::dataAddress( ), tx_chunk );
     }
 
-public:
-    /// Buffer type for convenience
-    using Buffer = std::remove_volatile_t< decltype( dma_buf ) >;
-
     /**
-     * @brief Read data from DMA buffer
+     * @brief Read an exact number of bytes
      * @param[out] buffer Pointer to destination buffer
-     * @param[in] length Required number of bytes (must == k_DmaBufferSize)
+     * @param[in] length Required number of bytes, see Receiver::canRead()
      * @return Actual number of bytes read (0 on error)
-     * @warning Not thread-safe! Requires external synchronization if called from multiple threads.
-     * @note Blocking operation (waits for data_ready == true)
+     * @note Blocking operation, sleeps until the bytes arrive
      */
     size_t readBytes(uint8_t *buffer, size_t length) {
-        if ( length != k_DmaBufferSize ) return 0;
-        
+        if ( !Rx::canRead( length ) ) return 0;
+
+        // Wait for data indefinitely
+        while ( !Rx::tryRead( buffer, length ) )
+            Clock::idle( );
+        return length;
+    }
+
+    /**
+     * @brief Read an exact number of bytes, give up after a timeout
+     * @param[out] buffer Pointer to destination buffer
+     * @param[in] length Required number of bytes, see Receiver::canRead()
+     * @param[in] timeout_ms Longest wait in milliseconds
+     * @return Actual number of bytes read, 0 on timeout or error
+     * @note Sleeps until the bytes arrive or the time is out
+     */
+    size_t readFor(uint8_t *buffer, size_t length, uint32_t timeout_ms) {
+        if ( !Rx::canRead( length ) ) return 0;
+
+        const uint32_t start = Clock::millis( );
+        while ( !Rx::tryRead( buffer, length ) ) {
+            if ( Clock::millis( ) - start >= timeout_ms )
+                return 0;
+            Clock::idle( );
+        }
+        return length;
+    }
+
+    /**
+     * @brief Zero-copy access to the next received frame, see Receiver::tryConsume()
+     * @param f Callback bool(const uint8_t *frame, size_t length)
+     * @return false if DMA overwrote the frame or the callback failed
+     * @note Blocking operation, sleeps until a frame arrives
+     */
+    template<typename F>
+    bool consume(F &&f) {
         // Wait for data indefinitely
-        while ( !data_ready );
-        // Interrupt protection
-        cm_disable_interrupts( );
-        for (uint32_t i = 0; i < k_DmaBufferSize; ++i)
-            buffer[i] = dma_buf[i];
-        // Check for new data
-        data_ready = !!(dma_get_interrupt_flag(DMA1, DMA_CHANNEL3, DMA_TCIF));
-        cm_enable_interrupts( );
-
-        return k_DmaBufferSize;
+        while ( this ->available( ) < static_cast< int >( k_frameSize ) )
+            Clock::idle( );
+        return Rx::tryConsume( f );
+    }
+
+    /**
+     * @brief Zero-copy access to the next received frame, give up after a timeout
+     * @param f Callback bool(const uint8_t *frame, size_t length)
+     * @param timeout_ms Longest wait in milliseconds
+     * @return false on timeout, if DMA overwrote the frame or the callback failed
+     */
+    template<typename F>
+    bool consumeFor(F &&f, uint32_t timeout_ms) {
+        const uint32_t start = Clock::millis( );
+        while ( this ->available( ) < static_cast< int >( k_frameSize ) ) {
+            if ( Clock::millis( ) - start >= timeout_ms )
+                return false;
+            Clock::idle( );
+        }
+        return Rx::tryConsume( f );
     }
 
     /**
-     * @brief Check if data is available for reading
-     * @return Number of available bytes
+     * @brief Register handlers for poll()
+     * @param onFrame Called with every received frame, nullptr to stop dispatching
+     * @param onSilence Called once per timeout_ms without frames, optional
+     * @param timeout_ms Silence length in milliseconds
+     * @param context Passed to the handlers
      */
-    int available() {
-        return data_ready ?k_DmaBufferSize :0;
+    void onReceive(FrameHandler onFrame, SilenceHandler onSilence, uint32_t timeout_ms, void *context) {
+        m_onFrame = onFrame;
+        m_onSilence = onSilence;
+        m_timeout = timeout_ms;
+        m_context = context;
+        m_last = Clock::millis( );
+    }
+
+    /**
+     * @brief Dispatch the frames received so far and report silence, never waits
+     * @details Call from the super-loop next to the other sources.
+     *          A frame is copied out of the DMA buffer and checked to be intact before the handler
+     *          sees it, so the handler may take its time; the pointer is valid during the call only.
+     * @return Number of dispatched frames
+     */
+    size_t poll() {
+        if ( !m_onFrame ) return 0;
+        size_t count = 0;
+        // Only what is there on entry, a fast sender does not starve the loop
+        for ( int frames = this ->available( ) / static_cast< int >( k_frameSize ); frames > 0; --frames ) {
+            Buffer frame;
+            if ( !Rx::tryRead( frame, k_frameSize ) )
+                continue;
+            m_onFrame( frame, k_frameSize, m_context );
+            ++count;
+        }
+        const uint32_t now = Clock::millis( );
+        if ( count ) {
+            m_last = now;
+        } else if ( m_onSilence && now - m_last >= m_timeout ) {
+            m_last = now;
+            m_onSilence( m_context );
+        }
+        return count;
     }
 
     /**
-     * @brief Initialize UART (USART3 on PC10, PC11 and DMA with interrupts)
+     * @brief Initialize UART and both DMA channels with interrupts
      * @param baud Baud rate
      */
     void begin(uint32_t baud) {
-        // Disable USART
-        usart_disable(k_usart);
         // Disable DMA
-        dma_disable_channel(DMA1, DMA_CHANNEL3);
-
-        rcc_periph_clock_enable(RCC_AFIO);
-        rcc_periph_clock_enable(RCC_GPIOC);
-        rcc_periph_clock_enable(RCC_USART3);
-        // Enable DMA1 clock
-        rcc_periph_clock_enable(RCC_DMA1);
-
-        // Configure DMA1 Channel3 for RX
-        dma_channel_reset(DMA1, DMA_CHANNEL3);
-        dma_set_peripheral_address(DMA1, DMA_CHANNEL3, (uint32_t)&USART_DR(k_usart));
-        dma_set_memory_address(DMA1, DMA_CHANNEL3, (uint32_t)dma_buf);
-        dma_set_number_of_data(DMA1, DMA_CHANNEL3, k_DmaBufferSize);
-        dma_enable_circular_mode(DMA1, DMA_CHANNEL3);
-        dma_enable_transfer_complete_interrupt(DMA1, DMA_CHANNEL3);
-        dma_enable_transfer_error_interrupt(DMA1, DMA_CHANNEL3);
-        dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL3);
-
-        gpio_primary_remap(AFIO_MAPR_SWJ_CFG_FULL_SWJ, AFIO_MAPR_USART3_REMAP_PARTIAL_REMAP);
-        // TX
-        gpio_set_mode(GPIOC, GPIO_MODE_OUTPUT_50_MHZ, GPIO_CNF_OUTPUT_ALTFN_PUSHPULL, GPIO10);
-        // RX
-        gpio_set_mode(GPIOC, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, GPIO11);
-
-        // 8E2 mode
-        usart_set_baudrate(k_usart, baud);
-        // 8 data bits + 1 parity bit
-        usart_set_databits(k_usart, 9);
-        // 2 stop bits
-        usart_set_stopbits(k_usart, USART_STOPBITS_2);
-        // Even parity
-        usart_set_parity(k_usart, USART_PARITY_EVEN);
-        usart_set_mode(k_usart, USART_MODE_TX_RX);
-        usart_set_flow_control(k_usart, USART_FLOWCONTROL_NONE);
-        usart_enable_rx_dma(k_usart);
-        usart_enable(k_usart);
-
-        dma_enable_channel(DMA1, DMA_CHANNEL3);
-        nvic_set_priority(NVIC_DMA1_CHANNEL3_IRQ, 0);
-        nvic_enable_irq(NVIC_DMA1_CHANNEL3_IRQ);
+        RxDma::stop();
+        TxDma::stop();
+        tx_queue.reset();
+        tx_chunk = 0;
+
+        Usart::begin(baud);
+
+        Rx::start();
+        // Below RX, a late TX start only delays sending
+        TxDma::begin(0x10);
     }
 
     /**
      * @brief Send a single byte
      * @param c Character to send
-     * @return Actual number of bytes sent
+     * @return Actual number of bytes queued, 0 if the queue is full
      */
     size_t write(char c) {
-        usart_send_blocking(USART3, c);
-        return sizeof( c );
+        return write(reinterpret_cast<const uint8_t *>(&c), sizeof(c));
     }
 
     /**
-     * @brief Send an array of data via UART
-     * @param buffer Pointer to buffer with data to send
+     * @brief Queue an array of data for sending via UART, does not wait
+     * @details All or nothing: a message is never split by a full queue.
+     * @param buffer Pointer to buffer with data to send, may be reused on return
      * @param size Number of bytes to send
-     * @return Actual number of bytes sent
+     * @return size, or 0 if the queue has no room for the whole array (back-pressure)
      */
     size_t write(const uint8_t *buffer, size_t size) {
-        for (size_t i = 0; i < size; i++) {
-            write(buffer[i]);
-        }
+        if ( !tx_queue.write( buffer, size ) )
+            return 0;
+        // Let the interrupt start DMA if it is idle
+        TxDma::pend();
+        return size;
+    }
+
+    /**
+     * @brief Queue several segments as one message, does not wait
+     * @details All or nothing, published at once: DMA sends them back-to-back
+     *          in one transfer (two if the queue wraps), no gathering buffer on the caller side.
+     * @param segments Pieces of the message, may be reused on return
+     * @param count Number of segments
+     * @return Total size, or 0 if the queue has no room for all of them (back-pressure)
+     */
+    size_t writev(const Tool::Segment *segments, size_t count) {
+        if ( !tx_queue.writev( segments, count ) )
+            return 0;
+        TxDma::pend();
+        size_t size = 0;
+        for ( size_t i = 0; i < count; ++i )
+            size += segments[ i ].size;
         return size;
     }
+
+    /**
+     * @brief Free space of the TX queue
+     * @return Number of bytes write() accepts now
+     */
+    size_t availableForWrite() const {
+        return tx_queue.free( );
+    }
+
+    /**
+     * @brief Wait until the queue is handed over to the USART
+     * @note The last bytes may still be shifting out of the USART
+     */
+    void flush() {
+        while ( !tx_queue.empty( ) );
+    }
 };
-// Alias so the linker sees the handler, as an alternative to mangled name you can wrap the whole class in `extern "C"`
-extern "C" void dma1_channel3_isr() __attribute__((alias("_ZN6Device12HardwareUART24DMA1_Channel3_IRQHandlerEv")));
-} // namespace Device
\ No newline at end of file
+
+#if defined( __arm__ )
+/**
+ * @brief USART3, RX on DMA1 channel 3, TX on DMA1 channel 2, vectors in HardwareUART.cpp
+ * @details The receiver is selected here for the whole firmware,
+ *          Uart::PingPongReceiver hands over fixed frames without copies;
+ *          both provide read(), which HighSpeedLink feeds to its resynchronizing reader.
+ */
+using HardwareUART = HardwareUARTTpl< Hal::Usart3, Hal::DmaChannel< 3 >, Hal::DmaChannel< 2 >, Hal::Clock, Uart::RingReceiver >;
+#endif
+} // namespace Device
@@ -0,0 +1,17 @@
+// src\Device\SpiDma.cpp - interrupt vectors of SpiDma
+// Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include "Device/SpiDma.h"
+
+/**
+ * @brief DMA1 channel 4 interrupt handler, SPI2 RX
+ */
+extern "C" void dma1_channel4_isr(void) {
+    Device::SpiDma::isr( );
+}
+
+/**
+ * @brief DMA1 channel 5 interrupt handler, SPI2 TX
+ */
+extern "C" void dma1_channel5_isr(void) {
+    Device::SpiDma::isr( );
+}
@@ -0,0 +1,134 @@
+// src\Device\SpiDma.h - full-duplex SPI transfers by a pair of DMA channels
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <stddef.h>
+#include <stdint.h>
+#if defined( __arm__ )
+#include "Device/Hal/Dma.h"
+#include "Device/Hal/Spi.h"
+#endif
+
+namespace Device {
+/**
+ * @class SpiDmaTpl
+ * @brief SPI master transfer that runs while the CPU keeps working
+ * @details RX channel is armed first, then TX clocks the bytes out; the slave is selected meanwhile.
+ *          TX completes earlier, the transfer ends when RX has received the last byte.
+ *          Completion is reported by the callback from the interrupt and by poll() from the main loop.
+ * @tparam Spi SPI policy, Hal::Spi2 or a host model
+ * @tparam RxDma DMA channel of the SPI RX request
+ * @tparam TxDma DMA channel of the SPI TX request
+ * @warning Both buffers must stay valid and unchanged until the completion
+ */
+template<typename Spi, typename RxDma, typename TxDma>
+class SpiDmaTpl {
+public:
+    /// Completion callback, runs in the interrupt context
+    using Callback = void(*)(void *context);
+
+    /// State of the transfer
+    enum class Status {
+        Idle,
+        Busy,
+        Done,
+        Failed
+    };
+
+    /**
+     * @brief Configure SPI and both DMA channels, once
+     * @param priority NVIC priority of both channel interrupts, equal so they do not preempt each other
+     */
+    void begin(uint8_t priority = k_priority) {
+        Spi::begin( );
+        RxDma::begin( priority );
+        TxDma::begin( priority );
+    }
+
+    /**
+     * @brief Start the transfer and return
+     * @param tx Bytes to send
+     * @param rx Received bytes, as many as sent
+     * @param size Number of bytes
+     * @param callback Called on success, optional
+     * @param context Passed to the callback
+     * @return false if the previous transfer is still running or nothing to transfer
+     */
+    bool start(const uint8_t *tx, uint8_t *rx, size_t size, Callback callback = nullptr, void *context = nullptr) {
+        if ( Status::Busy == m_status || !size )
+            return false;
+        m_callback = callback;
+        m_context = context;
+        m_status = Status::Busy;
+        s_active = this;
+        Spi::discard( );
+        Spi::select( );
+        // Receiver is ready before the first byte is clocked
+        RxDma::startFromPeripheral( Spi::dataAddress( ), rx, size, false );
+        TxDma::startToPeripheral( tx, Spi::dataAddress( ), size );
+        return true;
+    }
+
+    /// Transfer is running
+    bool isBusy() const {
+        return Status::Busy == m_status;
+    }
+
+    /**
+     * @brief State of the last transfer, polled from the main loop
+     * @return Busy until the completion, then Done or Failed on a DMA transfer error
+     */
+    Status poll() const {
+        return m_status;
+    }
+
+    /// Handles the channel interrupts of this instance
+    void onInterrupt() {
+        if ( RxDma::isError( ) || TxDma::isError( ) ) {
+            RxDma::clearError( );
+            TxDma::clearError( );
+            finish( Status::Failed );
+            return;
+        }
+        // TX alone: the last byte is still on the line
+        if ( TxDma::isComplete( ) )
+            TxDma::clearComplete( );
+        if ( RxDma::isComplete( ) )
+            finish( Status::Done );
+    }
+
+    /**
+     * @brief Handles the channel interrupts of the running instance
+     * @details Call from the vectors of both channels, see SpiDma.cpp
+     */
+    static void isr() {
+        if ( s_active )
+            s_active ->onInterrupt( );
+    }
+
+private:
+    /// Below USART RX and TX, above the CRC
+    static constexpr uint8_t k_priority = 0x20;
+    static inline SpiDmaTpl *s_active = nullptr;
+
+    void finish(Status status) {
+        RxDma::stop( );
+        TxDma::stop( );
+        // No flag left to raise the vectors again
+        RxDma::clearComplete( );
+        TxDma::clearComplete( );
+        Spi::deselect( );
+        s_active = nullptr;
+        m_status = status;
+        if ( Status::Done == status && m_callback )
+            m_callback( m_context );
+    }
+
+    volatile Status m_status = Status::Idle;
+    Callback m_callback = nullptr;
+    void *m_context = nullptr;
+};
+
+#if defined( __arm__ )
+/// SPI2, RX on DMA1 channel 4, TX on DMA1 channel 5, vectors in SpiDma.cpp
+using SpiDma = SpiDmaTpl< Hal::Spi2, Hal::DmaChannel< 4 >, Hal::DmaChannel< 5 > >;
+#endif
+} // namespace Device
@@ -0,0 +1,169 @@
+// src\Device\Uart\PingPongReceiver.h - UART reception of fixed frames into two alternating buffers
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include "Serialization/Config/Frame.h"
+
+namespace Device::Uart {
+/**
+ * @class PingPongReceiver
+ * @brief Double-buffered RX of fixed-size frames without copies
+ * @details Circular DMA runs over two frame buffers: half transfer completes the first one,
+ *          transfer complete the second. The application owns the completed buffer
+ *          while DMA fills the other, ownership swaps on each completion.
+ *          If DMA completes the other buffer before the owned one is released,
+ *          it already writes into the owned one: the frame is reported lost and counted as overrun.
+ * @tparam Usart USART policy
+ * @tparam Dma DMA channel of the USART RX request
+ * @note acquire(), tryRead() and tryConsume() expect frames to start at the DMA buffer start,
+ *       as with the original one-frame buffer; read() passes the bytes on for a resynchronizing reader
+ */
+template<typename Usart, typename Dma>
+class PingPongReceiver {
+    /// Frame of the fixed-size format
+    static constexpr size_t k_frameSize = Serialization::detail_::k_frameSize;
+
+    /// Both buffers in a row, one circular DMA transfer
+    inline static uint8_t rx_buf[ 2 ][ k_frameSize ] = { };
+    /// Buffers completed by DMA, runs freely, the low bit is the buffer index
+    inline static std::atomic< uint32_t > rx_filled{ 0 };
+    /// Buffers taken by the application
+    inline static uint32_t rx_taken = 0;
+    /// Number of frames lost because the application was late
+    inline static size_t rx_overruns = 0;
+
+    /// Completed buffers not taken, the older ones are overwritten already
+    static uint32_t rxPending() {
+        const uint32_t pending = rx_filled.load( std::memory_order_acquire ) - rx_taken;
+        if ( pending > 1 ) {
+            rx_overruns += pending - 1;
+            rx_taken += pending - 1;
+            return 1;
+        }
+        return pending;
+    }
+
+public:
+    /**
+     * @brief Start circular DMA over both buffers, the USART is already configured
+     */
+    static void start() {
+        rx_filled.store( 0, std::memory_order_relaxed );
+        rx_taken = 0;
+        rx_overruns = 0;
+        Dma::begin( 0 );
+        Dma::startFromPeripheral( Usart::dataAddress( ), rx_buf, sizeof( rx_buf ), true );
+        Dma::enableHalfInterrupt( );
+    }
+
+    /**
+     * @brief DMA interrupt handler of RX: each half is a completed buffer
+     */
+    static void rxIsr() {
+        // Ignore errors
+        if (Dma::isError()) {
+            Dma::clearError();
+        }
+        if (Dma::isHalf()) {
+            Dma::clearHalf();
+            rx_filled.fetch_add( 1, std::memory_order_release );
+        }
+        if (Dma::isComplete()) {
+            Dma::clearComplete();
+            rx_filled.fetch_add( 1, std::memory_order_release );
+        }
+    }
+
+    /// Line idle is not used, frames are completed by DMA
+    static void usartIsr() {
+        if (Usart::isIdle()) {
+            Usart::clearIdle();
+        }
+    }
+
+    /**
+     * @brief Take ownership of the oldest intact frame
+     * @return Pointer to the frame in the DMA buffer, nullptr if none has arrived
+     * @note Non-blocking, call release() when done
+     */
+    const uint8_t *acquire() {
+        if ( !rxPending( ) )
+            return nullptr;
+        return rx_buf[ rx_taken & 1 ];
+    }
+
+    /**
+     * @brief Give the acquired frame back to DMA
+     * @return false if DMA overwrote the frame while it was owned
+     */
+    bool release() {
+        // Reads of the frame complete before the counter is checked
+        std::atomic_thread_fence( std::memory_order_acquire );
+        const bool intact = rx_filled.load( std::memory_order_acquire ) - rx_taken <= 1;
+        ++rx_taken;
+        if ( !intact )
+            ++rx_overruns;
+        return intact;
+    }
+
+    /// Only whole frames
+    static constexpr bool canRead(size_t length) {
+        return length == k_frameSize;
+    }
+
+    /**
+     * @brief Read one frame if it has arrived
+     * @param[out] buffer Pointer to destination buffer
+     * @param[in] length Must be the frame size
+     * @return false if no frame has arrived or DMA overwrote it
+     * @note Non-blocking
+     */
+    bool tryRead(uint8_t *buffer, size_t length) {
+        if ( !canRead( length ) || !rxPending( ) ) return false;
+        memcpy( buffer, acquire( ), k_frameSize );
+        return release( );
+    }
+
+    /**
+     * @brief Take the oldest intact frame as stream bytes, e.g. for a resynchronizing reader
+     * @param[out] buffer Pointer to destination buffer
+     * @param[in] size Size of the buffer, less than a frame reads nothing
+     * @return Number of bytes read: a frame, 0 if none has arrived or DMA overwrote it
+     * @note Non-blocking. A frame lost to an overrun is missing from the stream, see overruns()
+     */
+    size_t read(uint8_t *buffer, size_t size) {
+        return ( size >= k_frameSize && tryRead( buffer, k_frameSize ) ) ?k_frameSize :0;
+    }
+
+    /**
+     * @brief Zero-copy access to the received frame right in its DMA buffer
+     * @details The callback has the time of one frame on the line before DMA wraps into its buffer.
+     * @param f Callback bool(const uint8_t *frame, size_t length)
+     * @return false if no frame has arrived, DMA overwrote the frame or the callback failed
+     * @note Non-blocking
+     */
+    template<typename F>
+    bool tryConsume(F &&f) {
+        if ( !rxPending( ) ) return false;
+        const bool result = f( acquire( ), k_frameSize );
+        return release( ) && result;
+    }
+
+    /**
+     * @brief Check if data is available for reading
+     * @return Number of available bytes, a frame or nothing
+     */
+    int available() {
+        return rxPending( ) ?static_cast< int >( k_frameSize ) :0;
+    }
+
+    /**
+     * @brief Number of frames lost because the application was late
+     */
+    size_t overruns() const {
+        return rx_overruns;
+    }
+};
+} // namespace Device::Uart
@@ -0,0 +1,192 @@
+// src\Device\Uart\RingReceiver.h - UART reception into a byte ring of any message length
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "Serialization/Config/Frame.h"
+#include "Tool/SpscRing.h"
+
+namespace Device::Uart {
+/**
+ * @class RingReceiver
+ * @brief RX as a byte ring filled by circular DMA, published on half transfer, transfer complete and line idle
+ * @details read() takes whatever has arrived, tryRead() an exact length, tryConsume() works on a frame in place.
+ *          Messages of any length, a lost byte does not misalign the following ones.
+ * @tparam Usart USART policy
+ * @tparam Dma DMA channel of the USART RX request
+ */
+template<typename Usart, typename Dma>
+class RingReceiver {
+public:
+    /// RX ring size, power of two, holds several frames
+    static constexpr size_t k_RxBufferSize = 256;
+
+private:
+    /// Frame of the fixed-size format
+    static constexpr size_t k_frameSize = Serialization::detail_::k_frameSize;
+
+    /**
+     * @brief Received bytes, DMA writes the storage endlessly, the interrupts commit them
+     * @details Head runs freely, its low bits are the DMA position.
+     */
+    inline static Tool::SpscRing< uint8_t, k_RxBufferSize > rx_ring;
+    /// Number of times DMA overwrote bytes not yet taken
+    inline static size_t rx_overruns = 0;
+
+    /// Bytes written by DMA up to now, with the ones not yet committed
+    static size_t rxWritten() {
+        const size_t head = rx_ring.head( );
+        const size_t position = k_RxBufferSize - Dma::remaining( );
+        return head + ( ( position - head ) & ( k_RxBufferSize - 1 ) );
+    }
+
+    /**
+     * @brief Commit the bytes written by DMA since the last interrupt
+     * @details Interrupts on every half of the ring keep the distance below one lap,
+     *          so the DMA position alone gives the count.
+     */
+    static void rxPublish() {
+        rx_ring.commit( rxWritten( ) - rx_ring.head( ) );
+    }
+
+    /// Bytes read from the ring before the call are intact only while DMA is less than one lap ahead of tail
+    static bool rxIntact() {
+        // Reads of the storage complete before the DMA position is taken
+        std::atomic_thread_fence( std::memory_order_acquire );
+        return rxWritten( ) - rx_ring.tail( ) <= k_RxBufferSize;
+    }
+
+    /// Drop everything on overrun, the bytes are mixed with the next lap
+    static size_t rxPending() {
+        if ( rx_ring.size( ) > k_RxBufferSize ) {
+            ++rx_overruns;
+            rx_ring.drop( );
+        }
+        return rx_ring.size( );
+    }
+
+public:
+    /**
+     * @brief Start circular DMA over the ring, the USART is already configured
+     */
+    static void start() {
+        rx_ring.reset( );
+        rx_overruns = 0;
+        // Both RX interrupts at one priority
+        Dma::begin( 0 );
+        Usart::enableIdleInterrupt( 0 );
+        Dma::startFromPeripheral( Usart::dataAddress( ), rx_ring.data( ), k_RxBufferSize, true );
+        Dma::enableHalfInterrupt( );
+    }
+
+    /**
+     * @brief DMA interrupt handler of RX: half transfer and transfer complete, circular mode
+     * @note Same priority as usartIsr(), they do not preempt each other
+     */
+    static void rxIsr() {
+        // Ignore errors
+        if (Dma::isError()) {
+            Dma::clearError();
+        }
+        if (Dma::isHalf()) {
+            Dma::clearHalf();
+        }
+        if (Dma::isComplete()) {
+            Dma::clearComplete();
+        }
+        rxPublish( );
+    }
+
+    /**
+     * @brief USART interrupt handler: line idle, a message shorter than half of the ring has ended
+     */
+    static void usartIsr() {
+        if (Usart::isIdle()) {
+            Usart::clearIdle();
+            rxPublish( );
+        }
+    }
+
+    /**
+     * @brief Take whatever bytes have arrived
+     * @param[out] buffer Pointer to destination buffer
+     * @param[in] size Size of the buffer
+     * @return Number of bytes read, 0 if nothing arrived or DMA overwrote them
+     * @warning Not thread-safe! Only one consumer.
+     * @note Non-blocking, interrupts stay enabled
+     */
+    size_t read(uint8_t *buffer, size_t size) {
+        rxPending( );
+        const size_t count = rx_ring.peek( buffer, size );
+        // DMA could lap the ring during the copy
+        if ( !rxIntact( ) ) {
+            ++rx_overruns;
+            rx_ring.drop( );
+            return 0;
+        }
+        rx_ring.release( count );
+        return count;
+    }
+
+    /// Lengths tryRead() can deliver, the ring must hold one more while the copy runs
+    static constexpr bool canRead(size_t length) {
+        return length <= k_RxBufferSize / 2;
+    }
+
+    /**
+     * @brief Read an exact number of bytes if they have arrived
+     * @param[out] buffer Pointer to destination buffer
+     * @param[in] length Required number of bytes, up to half of the ring
+     * @return false if fewer bytes arrived or DMA overwrote them
+     * @note Non-blocking
+     */
+    bool tryRead(uint8_t *buffer, size_t length) {
+        if ( !canRead( length ) || rxPending( ) < length ) return false;
+        return read( buffer, length ) == length;
+    }
+
+    /**
+     * @brief Zero-copy access to the received frame right in the DMA buffer
+     * @details Interrupts stay enabled. DMA keeps running, so the frame is valid only if
+     *          DMA did not lap the ring while the callback worked: its position is checked afterwards.
+     *          A frame wrapped around the end of the ring is copied first.
+     *          Keep the callback short (hash, unpack, hand over).
+     * @param f Callback bool(const uint8_t *frame, size_t length)
+     * @return false if no frame has arrived, DMA overwrote the frame or the callback failed
+     * @note Non-blocking
+     */
+    template<typename F>
+    bool tryConsume(F &&f) {
+        if ( rxPending( ) < k_frameSize ) return false;
+        uint8_t copy[ k_frameSize ];
+        const uint8_t *frame;
+        if ( rx_ring.readable( &frame ) < k_frameSize ) {
+            rx_ring.peek( copy, k_frameSize );
+            frame = copy;
+        }
+        const bool result = f( frame, k_frameSize );
+        if ( !rxIntact( ) ) {
+            ++rx_overruns;
+            rx_ring.drop( );
+            return false;
+        }
+        rx_ring.release( k_frameSize );
+        return result;
+    }
+
+    /**
+     * @brief Check if data is available for reading
+     * @return Number of available bytes
+     */
+    int available() {
+        return static_cast< int >( rxPending( ) );
+    }
+
+    /**
+     * @brief Number of times received bytes were lost because the main loop was late
+     */
+    size_t overruns() const {
+        return rx_overruns;
+    }
+};
+} // namespace Device::Uart
@@ -1,9 +1,7 @@
 // src\Node\HighSpeedLink.h - high-speed link module, receives a packet via UART, sends it to another module via SPI, and receives data back
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
-#include <libopencm3/stm32/dma.h>
-#include <libopencm3/stm32/rcc.h>
-#include <libopencm3/stm32/spi.h>
 #include "Device/HardwareUART.h"
+#include "Device/SpiDma.h"
 #include "Serialization/Serializer.h"
 #include "Device/Blinker.h"
 #include "Tool/Hexdumper.h"
@@ -13,43 +11,23 @@ namespace Node {
  * @class HighSpeedLink
  * @brief High-speed data transfer module between interfaces (UART <-> SPI)
  * @details Receives a packet via UART, sends it via SPI to another module, and receives data back.
+ *          SPI runs by DMA: the loop starts a transfer and returns, the response is handled on a later pass.
  */
 class HighSpeedLink {
+    static constexpr size_t k_frameSize = Serialization::Serializer::k_frameSize;
+
     /// Activity indicator, blinks when data is received
     Device::Blinker m_blinker;
-
-    /**
-     * @brief SPI transfer helper
-     * @details Sends data via SPI and receives response
-     * @param tx_buf Pointer to transmit buffer
-     * @param rx_buf Pointer to receive buffer
-     * @param len Number of bytes to transfer
-     */
-    void spi_transfer(uint8_t *tx_buf, uint8_t *rx_buf, size_t len) {
-        // Enable SPI1 clock
-        rcc_periph_clock_enable(RCC_SPI1);
-
-        // Configure pins (PA4=SS, PA5=SCK, PA7=MOSI, PA6=MISO)
-        gpio_set_mode(GPIOA, GPIO_MODE_OUTPUT_50_MHZ, GPIO_CNF_OUTPUT_ALTFN_PUSHPULL, GPIO4 | GPIO5 | GPIO7);
-        gpio_set_mode(GPIOA, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, GPIO6);
-
-        // Initialize SPI (Master, 8bit, mode 0)
-        spi_init_master(SPI1, SPI_CR1_BAUDRATE_FPCLK_DIV_8, 
-                        SPI_CR1_CPOL_CLK_TO_0_WHEN_IDLE,
-                        SPI_CR1_CPHA_CLK_TRANSITION_1,
-                        SPI_CR1_DFF_8BIT, SPI_CR1_MSBFIRST);
-        spi_enable(SPI1);
-
-        // SS LOW
-        gpio_clear(GPIOA, GPIO4);
-        // Transfer and receive
-        for (size_t i = 0; i < len; i++) {
-            rx_buf[i] = spi_xfer(SPI1, tx_buf[i]);
-        }
-        // SS HIGH
-        gpio_set(GPIOA, GPIO4);
-        spi_disable(SPI1);
-    }
+    /// Frame boundaries in the UART byte stream
+    Serialization::detail_::Framing::Resync< k_frameSize > m_sync;
+    /// Receiver overruns seen so far, a new one loses the lock
+    size_t m_overruns = 0;
+    /// SPI2 by DMA, configured once
+    Device::SpiDma m_spi;
+    /// Frame sent and the response, owned by DMA while the transfer runs
+    Device::HardwareUART::Buffer m_tx = { }, m_rx = { };
+    /// Response of a started transfer is not handled yet
+    bool m_pending = false;
 
 public:
     /**
@@ -58,6 +36,7 @@ public:
      */
     void begin() {
         m_blinker.begin();
+        m_spi.begin();
     }
 
     /**
@@ -67,23 +46,55 @@ public:
      * @param serializer Reference to serializer
      */
     void loop(Device::HardwareUART &uart, Serialization::Serializer &serializer) {
-        if (!uart.available()) return;
-        // Buffer for incoming data
-        Device::HardwareUART::Buffer buffer = { };
-        const size_t length = sizeof(buffer);
-        if (!uart.readBytes(buffer, length)) return;
-        Tool::Hex::dump(buffer, length, "UART");
+        // Response of the previous transfer
+        if (m_pending && !m_spi.isBusy()) {
+            m_pending = false;
+            if (Device::SpiDma::Status::Done == m_spi.poll())
+                output(serializer);
+        }
+        // A slipped byte breaks the lock, the frames are found again by their hash
+        uint8_t bytes[k_frameSize];
+        const size_t count = uart.read(bytes, sizeof(bytes));
+        if (uart.overruns() != m_overruns) {
+            m_overruns = uart.overruns();
+            m_sync.reset();
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const bool locked = m_sync.push(bytes[i], [&serializer](const uint8_t *frame) {
+                return serializer.verify(frame, k_frameSize);
+            });
+            if (locked)
+                forward(m_sync.frame());
+        }
+    }
+
+private:
+    /**
+     * @brief Starts sending a received frame via SPI, does not wait
+     * @details A transfer takes a few microseconds, much less than a frame on the UART,
+     *          so a frame arriving before the previous response is handled is rather a burst after a stall and is skipped.
+     * @param frame Frame of the locked phase
+     */
+    void forward(const uint8_t *frame) {
+        if (m_pending) return;
+        memcpy(m_tx, frame, sizeof(m_tx));
+        Tool::Hex::dump(m_tx, sizeof(m_tx), "UART");
         // Blink LED after receiving data, will turn off quickly due to SPI
         m_blinker.light();
+        m_pending = m_spi.start(m_tx, m_rx, sizeof(m_tx));
+    }
 
-        // Buffer for SPI response
-        Device::HardwareUART::Buffer rx_buf = { };
-        spi_transfer(buffer, rx_buf, length);
-        // Tool::Hex::dump(rx_buf, length, " SPI");
+    /**
+     * @brief Outputs the response of the slave
+     * @param serializer Reference to serializer
+     */
+    void output(Serialization::Serializer &serializer) {
+        const size_t length = sizeof(m_rx);
+        // Tool::Hex::dump(m_rx, length, " SPI");
 
         // Deserialize data
         Serialization::RawData rawDataRx;
-        bool b = serializer.deserialize(rx_buf, length, &rawDataRx);
+        bool b = serializer.deserialize(m_rx, length, &rawDataRx);
         LOG("deserialize: %s\r\n", (b ? "TRUE" : "FALSE"));
         if (!b) return;
 
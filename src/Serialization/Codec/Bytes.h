@@ -0,0 +1,37 @@
+// src\Serialization\Codec\Bytes.h - opaque bytes as a message of the Multiplexer, e.g. commands and logs
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Serialization::detail_::Codec {
+/**
+ * @class Bytes
+ * @brief Up to N bytes as they are, the receiver gets a view into the received message
+ * @tparam N Longest message
+ */
+template<size_t N>
+class Bytes {
+public:
+    /// Bytes in place, valid during the handler call only
+    struct Type {
+        const uint8_t *data;
+        size_t size;
+    };
+    static constexpr size_t k_maxSize = N;
+
+    /// Longer than N is not copied and rejected by the size
+    static size_t encode(Type const& value, uint8_t *output) {
+        if ( value.size <= N )
+            memcpy( output, value.data, value.size );
+        return value.size;
+    }
+
+    static bool decode(const uint8_t *input, size_t size, Type *value) {
+        if ( size > N )
+            return false;
+        *value = { input, size };
+        return true;
+    }
+};
+} // namespace Serialization::detail_::Codec
@@ -0,0 +1,50 @@
+// src\Serialization\Codec\Telemetry.h - RawData as a message of the Multiplexer, bit-packed
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "Serialization/Config/DataFormat.h"
+#include "Serialization/Packing/Batch.h"
+#include "Serialization/Packing/viaBitReader.h"
+
+/**
+ * @brief Message codecs of the Multiplexer
+ * @details Codec concept:
+ *          - Type: value handed to the sender and to the receiving handler
+ *          - k_maxSize: largest encoded value in bytes
+ *          - encode(Type const&, uint8_t *output): bytes written, above k_maxSize rejects the value
+ *          - decode(const uint8_t *input, size_t size, Type *): false if malformed
+ */
+namespace Serialization::detail_::Codec {
+/**
+ * @class Telemetry
+ * @brief Frame of Config::amount elements, same packing as the fixed frame of the Serializer
+ * @tparam Packer Fixed-width packer, see Packing/
+ */
+template<typename Packer = Packing::viaBitReader>
+class Telemetry {
+public:
+    using Type = RawData;
+    static constexpr size_t k_maxSize = sizeof( PackedData );
+
+    static size_t encode(Type const& value, uint8_t *output) {
+        PackedData packed;
+        Packer::pack( value, &packed );
+        memcpy( output, packed.data( ), sizeof( packed ) );
+        return sizeof( packed );
+    }
+
+    static bool decode(const uint8_t *input, size_t size, Type *value) {
+        if ( k_maxSize != size )
+            return false;
+        if constexpr ( Packing::detail_::HasView< Packer >::value ) {
+            Packer::unpack( PackedView( input ), value );
+        } else {
+            PackedData packed;
+            memcpy( packed.data( ), input, sizeof( packed ) );
+            Packer::unpack( packed, value );
+        }
+        return true;
+    }
+};
+} // namespace Serialization::detail_::Codec
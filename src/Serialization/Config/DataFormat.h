@@ -1,16 +1,22 @@
 // src\Serialization\Config\DataFormat.h - data format configuration
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <array>
+#include <cstdint>
+#include "Tool/CompileTimeConfigure.h"
+#include "Tool/Span.h"
 
 /**
  * @brief Data format configuration for serialization
  * @details Defines the structure and types used for packing and unpacking data.
+ *          Sizes are derived from Config.h via CompileTimeConfigure.
  */
 namespace Serialization {
+    /// Raw data, element type and amount from Config.h
+    using RawData = std::array< Tool::CompileTimeConfigure::InputType, Tool::CompileTimeConfigure::getInputAmount( ) >;
 namespace detail_ {
-    // Example: packed data structure for serialization
-    struct PackedData {
-        uint8_t data[8]; ///< Packed data buffer
-        // Add more fields as needed
-    };
+    /// Packed data, exactly CompileTimeConfigure::packedSize() bytes without padding
+    using PackedData = std::array< uint8_t, Tool::CompileTimeConfigure::packedSize( ) >;
+    /// Read-only view of packed data inside a received buffer, no copy
+    using PackedView = Tool::Span< const uint8_t, Tool::CompileTimeConfigure::packedSize( ) >;
 }
 }
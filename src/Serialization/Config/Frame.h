@@ -0,0 +1,23 @@
+// src\Serialization\Config\Frame.h - wire frame layout
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include "Serialization/Config/DataFormat.h"
+#include "Serialization/Config/Hashing.h"
+
+/**
+ * @brief Layout of a frame on the wire: packed data followed by its hash
+ * @details Shared by the sender (Serializer) and the receiver (HardwareUART DMA buffer),
+ *          so both sides follow the compile-time configuration.
+ */
+namespace Serialization {
+namespace detail_ {
+    // No padding bytes on the wire
+    static_assert( sizeof( PackedData ) == Tool::CompileTimeConfigure::packedSize( ), "Padding in packed data" );
+
+    /// Offset of the hash, right after the packed data
+    constexpr size_t k_hashOffset = sizeof( PackedData );
+
+    /// Size of one frame: packed data + hash
+    constexpr size_t k_frameSize = k_hashOffset + sizeof( HashReturnType );
+}
+}
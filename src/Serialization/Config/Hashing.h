@@ -1,13 +1,22 @@
 // src\Serialization\Config\Hashing.h - hashing configuration
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include "Serialization/Hash/CrcSoftware.h"
 
 /**
  * @brief Hashing configuration for serialization integrity checks
  * @details Used to select and configure the hash algorithm for data integrity.
+ *          Any type of the hasher concept (see Hash/ABase.h) fits, for example:
+ *          - Hash::CrcSoftware: CRC-8, 1 byte, weak for batches
+ *          - Hash::Crc16Software: CRC-16/CCITT, 2 bytes
+ *          - Hash::Crc32Software: CRC-32, 4 bytes
+ *          - Hash::CrcHardware: CRC-32 of the STM32 CRC unit, 4 bytes, target only
+ *          Hash width, Serializer frames and the HardwareUART DMA buffer follow the selected hasher.
  */
 namespace Serialization {
 namespace detail_ {
+    /// Hasher of the default Serializer and of the HardwareUART frame size
+    using Hasher = Hash::CrcSoftware;
     // Type for hash function return value
-    using HashReturnType = uint8_t;
+    using HashReturnType = Hasher::ReturnType;
 }
 }
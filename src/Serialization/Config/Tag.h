@@ -0,0 +1,39 @@
+// src\Serialization\Config\Tag.h - first byte of a tagged frame
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstdint>
+
+/**
+ * @brief Tag byte placed before each message when the Serializer encoding is not Plain
+ * @details Lets the receiver tell a full frame from a short token without guessing.
+ *          Bit layout: 1hhhhhhh repeat token, 01llllll delta of length l, 00cccccc codec c.
+ */
+namespace Serialization {
+namespace detail_ {
+namespace Tag {
+    /// Full frame follows: packed data + hash
+    constexpr uint8_t k_frame = 0x00;
+    /// Raw elements follow: InputType each as in memory + hash
+    constexpr uint8_t k_raw = 0x01;
+    /// Repeat token flag, the whole message is this single byte
+    constexpr uint8_t k_repeat = 0x80;
+    /// Low 7 bits of the repeat token: low bits of the hash of the repeated message, bind the token to it
+    constexpr uint8_t k_repeatCheck = 0x7F;
+    /// Repeat tokens after a full frame, then it is sent in full again
+    constexpr uint8_t k_maxRepeats = 0x7F;
+    /// Delta flag, delta-varint body of the length in the low 6 bits follows + hash
+    constexpr uint8_t k_delta = 0x40;
+    /// Longest delta body that fits into the tag
+    constexpr uint8_t k_maxDelta = 0x3F;
+
+    constexpr bool isRepeat(uint8_t tag) {
+        return tag & k_repeat;
+    }
+    constexpr bool isDelta(uint8_t tag) {
+        return ( tag & ( k_repeat | k_delta ) ) == k_delta;
+    }
+    constexpr uint8_t deltaSize(uint8_t tag) {
+        return tag & k_maxDelta;
+    }
+}
+}
+}
@@ -0,0 +1,197 @@
+// src\Serialization\Framing\Cobs.h - consistent overhead byte stuffing, messages delimited by a zero byte
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <cstdint>
+#include "Serialization/Framing/Raw.h"
+
+namespace Serialization::detail_::Framing {
+/**
+ * @class Cobs
+ * @brief Self-synchronizing framing: no zero byte inside a message, a zero byte after it
+ * @details Every block of up to 254 non-zero bytes is preceded by its length + 1,
+ *          the zero that ended the block is implied. Overhead is one byte per 254 plus the delimiter.
+ *          A lost or spurious byte damages only the message it hit: the receiver
+ *          starts over at the next delimiter, see Cobs::Reader.
+ */
+class Cobs {
+    /// Longest block: code byte 0xFF, no implied zero after it
+    static constexpr size_t k_maxBlock = 254;
+    static constexpr uint8_t k_delimiter = 0;
+
+    /// Encodes segments into a buffer of maxSize() of their total, block by block
+    class Encoder {
+        uint8_t *m_output;
+        /// Position of the code byte of the open block
+        size_t m_code = 0;
+        size_t m_size = 1;
+
+        void close() {
+            m_output[ m_code ] = static_cast< uint8_t >( m_size - m_code );
+            m_code = m_size++;
+        }
+
+    public:
+        explicit Encoder(uint8_t *output) :
+            m_output( output )
+        {}
+        void put(Segment const& segment) {
+            const uint8_t *bytes = static_cast< const uint8_t *>( segment.data );
+            for ( size_t i = 0; i < segment.size; ++i ) {
+                if ( k_delimiter == bytes[ i ] ) {
+                    close( );
+                    continue;
+                }
+                m_output[ m_size++ ] = bytes[ i ];
+                if ( 1 + k_maxBlock == m_size - m_code )
+                    close( );
+            }
+        }
+        /// Closes the last block, appends the delimiter
+        size_t finish() {
+            m_output[ m_code ] = static_cast< uint8_t >( m_size - m_code );
+            m_output[ m_size ] = k_delimiter;
+            return m_size + 1;
+        }
+    };
+
+public:
+    /// Encoded message with the delimiter
+    static constexpr size_t maxSize(size_t size) {
+        return size + size / k_maxBlock + 2;
+    }
+
+    /**
+     * @brief Encodes the segments as one message and sends it with the delimiter by one stream write
+     * @details An all-or-nothing stream, e.g. HardwareUART with a full queue, takes the whole message
+     *          or none of it: a partial message would run into the next one.
+     * @tparam MaxSize Longest message of the caller, sizes the encoding buffer on the stack
+     * @tparam T Output stream type
+     * @param stream Pointer to output stream
+     * @param segments Parts of the message
+     * @return true if everything was written, false if longer than MaxSize or not taken by the stream
+     */
+    template<size_t MaxSize = k_maxBlock, typename T, typename... Segments>
+    static bool write(T *stream, Segments const&... segments) {
+        if ( ( size_t{ 0 } + ... + segments.size ) > MaxSize )
+            return false;
+        uint8_t buffer[ maxSize( MaxSize ) ];
+        Encoder encoder( buffer );
+        ( ..., encoder.put( segments ) );
+        const size_t size = encoder.finish( );
+        return stream ->write( buffer, size ) == size;
+    }
+
+    /**
+     * @brief Decodes one message without its delimiter
+     * @details Output may be the input itself: the write position never passes the read position.
+     * @param input Encoded bytes
+     * @param size Number of encoded bytes
+     * @param output Decoded bytes
+     * @param[out] length Number of decoded bytes
+     * @param capacity Size of the output
+     * @return false if malformed (zero byte, truncated block) or longer than capacity
+     */
+    static bool decode(const uint8_t *input, size_t size, uint8_t *output, size_t *length, size_t capacity) {
+        if ( !size )
+            return false;
+        size_t in = 0, out = 0;
+        while ( in < size ) {
+            const size_t code = input[ in++ ];
+            if ( !code || code - 1 > size - in || code - 1 > capacity - out )
+                return false;
+            for ( size_t i = 1; i < code; ++i ) {
+                if ( k_delimiter == input[ in ] )
+                    return false;
+                output[ out++ ] = input[ in++ ];
+            }
+            // Implied zero, except after a full block and at the end
+            if ( 1 + k_maxBlock != code && in < size ) {
+                if ( out == capacity )
+                    return false;
+                output[ out++ ] = k_delimiter;
+            }
+        }
+        *length = out;
+        return true;
+    }
+
+    /**
+     * @brief Decodes the first message of the received bytes in place
+     * @details Delimiters before the message are skipped, bytes after its delimiter are ignored.
+     * @param input Received bytes, e.g. a frame returned by Reader::push(); overwritten by the message
+     * @param[in,out] size Number of received bytes, then of the message
+     * @return Message inside the input, nullptr if malformed
+     */
+    static uint8_t *unwrap(uint8_t *input, size_t *size) {
+        size_t begin = 0;
+        while ( begin < *size && k_delimiter == input[ begin ] )
+            ++begin;
+        size_t end = begin;
+        while ( end < *size && k_delimiter != input[ end ] )
+            ++end;
+        uint8_t *message = input + begin;
+        if ( !decode( message, end - begin, message, size, end - begin ) )
+            return nullptr;
+        return message;
+    }
+    /// Decoding in place needs writable bytes
+    static const uint8_t *unwrap(const uint8_t *input, size_t *size) = delete;
+
+    /**
+     * @class Reader
+     * @brief Collects stream bytes into encoded messages, resynchronizes on the delimiter
+     * @details Bytes up to the next delimiter after reset() or an overflow are discarded.
+     *          A message joined in the middle fails to decode or its hash check,
+     *          so the receiver is aligned again within one message.
+     * @tparam Capacity Longest encoded message without the delimiter, e.g. maxSize() of the largest one
+     */
+    template<size_t Capacity>
+    class Reader {
+        uint8_t m_buffer[ Capacity ];
+        size_t m_size = 0;
+        /// Inside a message that did not fit, or after reset()
+        bool m_skip = false;
+        size_t m_dropped = 0;
+
+    public:
+        /**
+         * @brief Take one received byte
+         * @param byte Received byte
+         * @param[out] size Number of encoded bytes of the completed message
+         * @return Encoded message without the delimiter, valid until the next push() and writable
+         *         for unwrap() in place; nullptr if not complete
+         */
+        uint8_t *push(uint8_t byte, size_t *size) {
+            if ( k_delimiter == byte ) {
+                const bool complete = !m_skip && m_size;
+                *size = m_size;
+                m_size = 0;
+                m_skip = false;
+                return complete ?m_buffer :nullptr;
+            }
+            if ( m_skip )
+                return nullptr;
+            if ( Capacity == m_size ) {
+                // Line noise ate the delimiter, wait for the next one
+                ++m_dropped;
+                m_size = 0;
+                m_skip = true;
+                return nullptr;
+            }
+            m_buffer[ m_size++ ] = byte;
+            return nullptr;
+        }
+
+        /// Forget the collected bytes, wait for a delimiter
+        void reset() {
+            m_size = 0;
+            m_skip = true;
+        }
+
+        /// Messages discarded because they did not fit
+        size_t dropped() const {
+            return m_dropped;
+        }
+    };
+};
+} // namespace Serialization::detail_::Framing
@@ -0,0 +1,67 @@
+// src\Serialization\Framing\Raw.h - messages written to the stream as they are
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "Tool/Segment.h"
+
+/**
+ * @brief Framing policies of the Serializer
+ * @details Framing concept, a message is written as several segments to avoid gathering copies:
+ *          - maxSize(size): bytes on the wire for a message of size bytes
+ *          - write<MaxSize>(stream, segments...): frame and send the segments as one message,
+ *            by one stream ->writev(segments, count) if the stream has it; MaxSize is the longest message
+ *            of the caller, for a framing that encodes into a buffer
+ *          - unwrap(input, &size): message inside the received bytes, decoded in place by a framing
+ *            that encodes (then input must be writable); nullptr if malformed
+ */
+namespace Serialization::detail_::Framing {
+/// Part of a message
+using Segment = Tool::Segment;
+
+namespace detail_ {
+// Stream takes a list of segments: size_t writev(const Segment *, size_t)
+template<typename T, typename = void>
+struct HasWritev : std::false_type {};
+template<typename T>
+struct HasWritev< T, std::void_t< 
+        decltype( std::declval< T & >( ).writev( static_cast< const Segment *>( nullptr ), size_t{ } ) )
+    > > : std::true_type {};
+} // namespace detail_
+
+/**
+ * @class Raw
+ * @brief No framing, the message length follows from its content (fixed frame or tag byte)
+ */
+class Raw {
+public:
+    static constexpr size_t maxSize(size_t size) {
+        return size;
+    }
+
+    /**
+     * @brief Sends the segments one after another, as one vectored write if the stream supports it
+     * @tparam MaxSize Unused, the segments are not copied
+     * @tparam T Output stream type
+     * @param stream Pointer to output stream
+     * @param segments Parts of the message
+     * @return true if everything was written
+     */
+    template<size_t MaxSize = 0, typename T, typename... Segments>
+    static bool write(T *stream, Segments const&... segments) {
+        if constexpr ( detail_::HasWritev< T >::value ) {
+            const Segment list[] = { segments... };
+            return stream ->writev( list, sizeof...( segments ) ) == ( ... + segments.size );
+        } else {
+            return ( ... && ( stream ->write( static_cast< const uint8_t *>( segments.data ), segments.size ) == segments.size ) );
+        }
+    }
+
+    /// Received bytes are the message itself, read-only or not
+    template<typename Byte>
+    static Byte *unwrap(Byte *input, size_t *) {
+        return input;
+    }
+};
+} // namespace Serialization::detail_::Framing
@@ -0,0 +1,122 @@
+// src\Serialization\Framing\Resync.h - finds fixed frame boundaries in a byte stream by their hash
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <cstdint>
+
+namespace Serialization::detail_::Framing {
+/**
+ * @class Resync
+ * @brief Receiver side of Raw framing with fixed frames: recovers from a slipped byte
+ * @details Hunting: every byte completes a candidate frame at a new offset, the check decides.
+ *          Verifying: after a match the following frames at the same phase must match too,
+ *          LockAfter of them in a row lock the phase, a short hash matches at random otherwise.
+ *          Locked: frames are delivered; LoseAfter bad frames in a row restart the hunt,
+ *          a single damaged frame is only dropped.
+ *          Costs two stores per byte and one check per byte while hunting, one per frame when locked.
+ * @tparam FrameSize Bytes of a frame
+ * @tparam LockAfter Matching frames in a row before the first delivery
+ * @tparam LoseAfter Bad frames in a row that break the lock
+ */
+template<size_t FrameSize, size_t LockAfter = 3, size_t LoseAfter = 2>
+class Resync {
+    static_assert( FrameSize && LockAfter && LoseAfter, "Empty frame or thresholds" );
+
+public:
+    enum class State {
+        Hunting,
+        Verifying,
+        Locked
+    };
+
+private:
+    /// Every byte is stored twice, so the last FrameSize bytes are always contiguous
+    uint8_t m_window[ 2 * FrameSize ] = { };
+    /// Oldest byte of the window
+    size_t m_pos = 0;
+    /// Bytes since the last frame boundary, saturates while hunting
+    size_t m_fill = 0;
+    /// Matches in a row while verifying, bad frames in a row while locked
+    size_t m_count = 0;
+    State m_state = State::Hunting;
+    size_t m_losses = 0;
+
+public:
+    /**
+     * @brief Take one received byte
+     * @param byte Received byte
+     * @param check Callback bool(const uint8_t *frame), e.g. Serializer::verify()
+     * @return true if a frame of the locked phase passed the check, see frame()
+     */
+    template<typename F>
+    bool push(uint8_t byte, F &&check) {
+        m_window[ m_pos ] = m_window[ m_pos + FrameSize ] = byte;
+        m_pos = ( m_pos + 1 ) % FrameSize;
+        if ( m_fill < FrameSize )
+            ++m_fill;
+        if ( m_fill < FrameSize )
+            return false;
+
+        if ( State::Hunting == m_state ) {
+            if ( check( frame( ) ) )
+                phase( );
+            return State::Locked == m_state;
+        }
+        // Next boundary of the phase
+        m_fill = 0;
+        const bool valid = check( frame( ) );
+        if ( State::Verifying == m_state ) {
+            if ( !valid ) {
+                hunt( );
+                return false;
+            }
+            if ( ++m_count == LockAfter )
+                m_state = State::Locked;
+            return State::Locked == m_state;
+        }
+        if ( valid ) {
+            m_count = 0;
+            return true;
+        }
+        if ( ++m_count == LoseAfter ) {
+            ++m_losses;
+            hunt( );
+        }
+        return false;
+    }
+
+    /// Last FrameSize bytes, the frame after push() returned true; valid until the next push()
+    const uint8_t *frame() const {
+        return m_window + m_pos;
+    }
+
+    State state() const {
+        return m_state;
+    }
+
+    /// Locks broken by bad frames
+    size_t losses() const {
+        return m_losses;
+    }
+
+    /// Back to hunting, e.g. after the receiver reported an overrun
+    void reset() {
+        hunt( );
+        m_fill = 0;
+    }
+
+private:
+    /// A match while hunting, the next boundary is FrameSize bytes away
+    void phase() {
+        m_fill = 0;
+        m_count = 1;
+        m_state = ( 1 == LockAfter ) ?State::Locked :State::Verifying;
+    }
+
+    /// The window stays full, the next byte gives the next offset
+    void hunt() {
+        m_count = 0;
+        m_state = State::Hunting;
+        m_fill = FrameSize;
+    }
+};
+} // namespace Serialization::detail_::Framing
@@ -1,26 +1,82 @@
 // src\Serialization\Hash\ABase.h - base class for hash algorithms
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "Tool/Span.h"
 
 /**
- * @brief Abstract base class for hash algorithms
- * @details Provides interface for hash calculation used in serialization.
+ * @brief Static interface of hash algorithms
+ * @details Hasher concept, resolved at compile time without virtual calls:
+ *          - ReturnType: type of the hash value, written to the wire as sizeof(ReturnType) bytes
+ *          - begin(): one-time initialization, e.g. peripheral clock
+ *          - init(), update(const void *data, size_t size), finalize(): hash of data arriving in pieces
+ *          - calculate(const void *data, size_t size): hash of one buffer, provided by ABase
+ *          Any split of the data into update() calls gives the same hash as calculate() over all of it.
  */
-namespace Serialization {
-namespace Hash {
+namespace Serialization::detail_::Hash {
 /**
  * @class ABase
- * @brief Abstract base for hash calculation
+ * @brief CRTP base providing the common part of the hasher concept
+ * @tparam Derived Hasher type, provides init(), update(const void*, size_t) and finalize()
+ * @tparam Return Type of the hash value
  */
+template<typename Derived, typename Return>
 class ABase {
 public:
+    /// Type of the hash value
+    using ReturnType = Return;
+
+    /// Nothing to initialize by default
+    void begin() {
+    }
+
     /**
-     * @brief Calculate hash for given data
+     * @brief Calculate hash for a data buffer
      * @param data Pointer to data
-     * @param size Size of data in bytes
+     * @param size Size in bytes
+     * @return Hash value
+     */
+    ReturnType calculate(const void *data, size_t size) {
+        Derived &derived = *static_cast< Derived *>( this );
+        derived.init( );
+        derived.update( data, size );
+        return derived.finalize( );
+    }
+
+    /**
+     * @brief Calculate hash for a byte array, e.g. PackedData
+     * @param data Byte array
      * @return Hash value
      */
-    virtual uint8_t calculate(const void* data, size_t size) const = 0;
-    virtual ~ABase() = default;
+    template<size_t N>
+    ReturnType calculate(std::array< uint8_t, N > const& data) {
+        return calculate( data.data( ), N );
+    }
+
+    /**
+     * @brief Add a piece of data viewed in place, e.g. PackedView
+     * @param data View of the bytes
+     */
+    template<size_t N>
+    void update(Tool::Span< const uint8_t, N > data) {
+        static_cast< Derived *>( this ) ->update( data.data( ), N );
+    }
 };
-}
-}
+
+// Type satisfies the hasher concept
+template<typename T, typename = void>
+struct IsHasher : std::false_type {};
+template<typename T>
+struct IsHasher< T, std::void_t< 
+        typename T::ReturnType
+        , decltype( std::declval< T & >( ).begin( ) )
+        , decltype( std::declval< T & >( ).init( ) )
+        , decltype( std::declval< T & >( ).update( std::declval< const void *>( ), size_t{ } ) )
+        , std::enable_if_t< std::is_same_v< typename T::ReturnType, decltype( std::declval< T & >( ).finalize( ) ) > >
+        , std::enable_if_t< std::is_same_v< typename T::ReturnType
+            , decltype( std::declval< T & >( ).calculate( std::declval< const void *>( ), size_t{ } ) ) > >
+    > > : std::true_type {};
+} // namespace Serialization::detail_::Hash
@@ -0,0 +1,10 @@
+// src\Serialization\Hash\CrcDma.cpp - interrupt vector of CrcDma
+// Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include "Serialization/Hash/CrcDma.h"
+
+/**
+ * @brief DMA1 channel 1 interrupt handler, memory to CRC unit
+ */
+extern "C" void dma1_channel1_isr(void) {
+    Serialization::detail_::Hash::CrcDma::isr( );
+}
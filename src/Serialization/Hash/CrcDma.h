@@ -0,0 +1,168 @@
+// src\Serialization\Hash\CrcDma.h - hardware CRC fed by memory-to-memory DMA
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined( __arm__ )
+#include "Device/Hal/Crc.h"
+#include "Device/Hal/Dma.h"
+#endif
+
+namespace Serialization::detail_::Hash {
+/**
+ * @class CrcDmaTpl
+ * @brief CRC of a large buffer calculated by the CRC unit while the CPU keeps working
+ * @details A memory-to-memory DMA channel streams the whole words of the buffer into the CRC data register.
+ *          On transfer complete the interrupt feeds the last incomplete word, padded with zeros,
+ *          so the value is the same as CrcHardware::calculate() of the buffer.
+ *          Completion is reported by the callback from the interrupt and by poll() from the main loop.
+ *          DMA moves aligned words only: a buffer not aligned to a word or shorter than one word
+ *          is hashed by the CPU inside start(), in the caller's context, then the channel interrupt
+ *          raised by software completes it, so the callback still comes from isr().
+ * @tparam Dma DMA channel policy, Device::Hal::DmaChannel or a host model
+ * @tparam Crc CRC unit policy, Device::Hal::Crc or a host model
+ * @warning There is one CRC unit, do not use CrcHardware while a calculation is running.
+ *          The buffer must stay unchanged until the completion.
+ */
+template<typename Dma, typename Crc>
+class CrcDmaTpl {
+public:
+    using ReturnType = uint32_t;
+    /// Completion callback, runs in the interrupt context of the channel, never inside start()
+    using Callback = void(*)(ReturnType crc, void *context);
+
+    /// State of the calculation
+    enum class Status {
+        Idle,
+        Busy,
+        Done,
+        Failed
+    };
+
+    /**
+     * @brief Initialize the CRC unit and the DMA channel
+     * @param priority NVIC priority of the channel interrupt
+     */
+    void begin(uint8_t priority = k_priority) {
+        Crc::begin( );
+        Dma::begin( priority );
+    }
+
+    /**
+     * @brief Start the calculation
+     * @param data Pointer to data, must stay valid until the completion
+     * @param size Size in bytes
+     * @param callback Called on success, optional
+     * @param context Passed to the callback
+     * @return false if the previous calculation is still running
+     */
+    bool start(const void *data, size_t size, Callback callback = nullptr, void *context = nullptr) {
+        if ( Status::Busy == m_status.load( std::memory_order_acquire ) )
+            return false;
+        const uint8_t *bytes = static_cast< const uint8_t *>( data );
+        const size_t words = size / k_wordSize;
+        m_tail = 0;
+        memcpy( &m_tail, bytes + words * k_wordSize, size % k_wordSize );
+        m_hasTail = size % k_wordSize;
+        m_callback = callback;
+        m_context = context;
+        Crc::reset( );
+        m_status.store( Status::Busy, std::memory_order_relaxed );
+        s_active = this;
+        if ( !words || reinterpret_cast< uintptr_t >( bytes ) % k_wordSize ) {
+            // Hashed here, not in the interrupt: it would hold back the lower priority ones
+            for ( size_t i = 0; i < words; ++i ) {
+                uint32_t word;
+                memcpy( &word, bytes + i * k_wordSize, sizeof( word ) );
+                Crc::write( word );
+            }
+            m_byCpu = true;
+            Dma::pend( );
+            return true;
+        }
+        m_byCpu = false;
+        Dma::startWordsToRegister( bytes, Crc::dataAddress( ), words );
+        return true;
+    }
+
+    /// Calculation is running
+    bool isBusy() const {
+        return Status::Busy == m_status.load( std::memory_order_acquire );
+    }
+
+    /**
+     * @brief Result of the last calculation, polled from the main loop
+     * @param crc Receives the CRC if Done
+     * @return Busy until the completion, then Done or Failed on a DMA transfer error
+     */
+    Status poll(ReturnType *crc) const {
+        // Acquire pairs with the release in complete(), m_crc is visible with Done
+        const Status status = m_status.load( std::memory_order_acquire );
+        if ( Status::Done == status )
+            *crc = m_crc;
+        return status;
+    }
+
+    /// Handles the channel interrupt of this instance
+    void onInterrupt() {
+        if ( m_byCpu ) {
+            m_byCpu = false;
+            s_active = nullptr;
+            complete( );
+            return;
+        }
+        if ( Dma::isError( ) ) {
+            Dma::clearError( );
+            Dma::stop( );
+            s_active = nullptr;
+            m_status.store( Status::Failed, std::memory_order_release );
+            return;
+        }
+        if ( !Dma::isComplete( ) )
+            return;
+        Dma::clearComplete( );
+        Dma::stop( );
+        s_active = nullptr;
+        complete( );
+    }
+
+    /**
+     * @brief Handles the channel interrupt of the running instance
+     * @details Call from the vector of the channel, e.g. for CrcDma:
+     *          extern "C" void dma1_channel1_isr() { CrcDma::isr( ); }
+     */
+    static void isr() {
+        if ( s_active )
+            s_active ->onInterrupt( );
+    }
+
+private:
+    static constexpr size_t k_wordSize = sizeof( uint32_t );
+    static constexpr uint8_t k_priority = 0x80;
+    static inline CrcDmaTpl *s_active = nullptr;
+
+    void complete() {
+        m_crc = m_hasTail ?Crc::write( m_tail ) :Crc::read( );
+        m_status.store( Status::Done, std::memory_order_release );
+        if ( m_callback )
+            m_callback( m_crc, m_context );
+    }
+
+    /// Published last by the interrupt, with release: m_crc is written before it
+    std::atomic< Status > m_status{ Status::Idle };
+    ReturnType m_crc = 0;
+    /// Words were hashed by start(), the interrupt only completes
+    bool m_byCpu = false;
+    /// Last incomplete word, padded with zeros
+    uint32_t m_tail = 0;
+    bool m_hasTail = false;
+    Callback m_callback = nullptr;
+    void *m_context = nullptr;
+};
+
+#if defined( __arm__ )
+/// DMA1 channel 1, the other channels are taken by USART3 and SPI
+using CrcDma = CrcDmaTpl< Device::Hal::DmaChannel< 1 >, Device::Hal::Crc >;
+#endif
+} // namespace Serialization::detail_::Hash
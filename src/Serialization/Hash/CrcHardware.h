@@ -1,48 +1,92 @@
 // src\Tool\Serialization\Hash\CrcHardware.h - hardware CRC calculation
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
 #include <libopencm3/stm32/crc.h>
-#include "Serialization/Config/DataFormat.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include "Serialization/Hash/ABase.h"
 
 namespace Serialization::detail_::Hash {
 /**
  * @class CrcHardware
  * @brief Calculates CRC using hardware peripheral
+ * @details The peripheral takes whole 32-bit words, so up to 3 bytes of a piece wait
+ *          for the next update(); finalize() pads them with zeros.
+ * @warning There is one CRC unit, hashes of two instances must not interleave.
  */
-class CrcHardware final : public ABase {
+class CrcHardware final : public ABase< CrcHardware, uint32_t > {
+    static constexpr size_t k_wordSize = sizeof( uint32_t );
+
+    /// CRC after the last full word, reset value of the data register initially
+    uint32_t m_crc = 0xFFFFFFFF;
+    /// Bytes not yet forming a full word
+    uint8_t m_pending[ k_wordSize ] = { };
+    size_t m_pendingSize = 0;
+
 public:
+    using ABase::update;
+
     /**
      * @brief Initialize CRC hardware
      */
-    void begin() override {
+    void begin() {
         rcc_periph_clock_enable(RCC_CRC);
     }
 
+    /// Start a new CRC
+    void init() {
+        crc_reset();
+        m_crc = 0xFFFFFFFF;
+        m_pendingSize = 0;
+    }
+
     /**
-     * @brief Calculate CRC for a data buffer
+     * @brief Add a piece of data to the CRC
      * @param data Pointer to data
      * @param size Size in bytes
-     * @return CRC value
      */
-    uint32_t calculate(const void* data, size_t size) {
-        const size_t blockSize = sizeof(uint32_t);
-        const size_t fullBlocks = size / blockSize;
-        const size_t remainingBytes = size % blockSize;
-
-        crc_reset();
-        // Process full 32-bit blocks
-        uint32_t crc = crc_calculate_block(
-            reinterpret_cast<const uint32_t*>(data),
-            fullBlocks
-        );
+    void update(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        // Complete the word started by the previous piece
+        if (m_pendingSize) {
+            const size_t take = std::min(k_wordSize - m_pendingSize, size);
+            memcpy(m_pending + m_pendingSize, bytes, take);
+            m_pendingSize += take;
+            bytes += take;
+            size -= take;
+            if (m_pendingSize < k_wordSize)
+                return;
+            uint32_t word;
+            memcpy(&word, m_pending, sizeof(word));
+            m_crc = crc_calculate(word);
+            m_pendingSize = 0;
+        }
+        // Process full 32-bit blocks; after a completed word an aligned buffer is not aligned any more,
+        // and word loads of an unaligned address fault (LDM/LDRD) or alias a byte buffer
+        const size_t fullBlocks = size / k_wordSize;
+        if (fullBlocks && 0 == reinterpret_cast<uintptr_t>(bytes) % alignof(uint32_t)) {
+            m_crc = crc_calculate_block(reinterpret_cast<const uint32_t*>(bytes), fullBlocks);
+        } else {
+            for (size_t i = 0; i < fullBlocks; ++i) {
+                uint32_t word;
+                memcpy(&word, bytes + i * k_wordSize, sizeof(word));
+                m_crc = crc_calculate(word);
+            }
+        }
+        // Keep remaining bytes
+        m_pendingSize = size % k_wordSize;
+        memcpy(m_pending, bytes + fullBlocks * k_wordSize, m_pendingSize);
+    }
 
-        // Process remaining bytes
-        if (remainingBytes) {
+    /// CRC of all data since init(), the incomplete last word is padded with zeros
+    uint32_t finalize() {
+        if (m_pendingSize) {
             uint32_t lastWord = 0;
-            memcpy(&lastWord, static_cast<const uint8_t*>(data) + fullBlocks * blockSize, remainingBytes);
-            crc = crc_calculate(lastWord);
+            memcpy(&lastWord, m_pending, m_pendingSize);
+            m_crc = crc_calculate(lastWord);
+            m_pendingSize = 0;
         }
-        return crc;
+        return m_crc;
     }
 };
 } // namespace Serialization::detail_::Hash
@@ -2,48 +2,195 @@
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
 #include <cstdint>
 #include <array>
-#include "Serialization/Config/DataFormat.h"
+#include <limits>
 #include "Serialization/Hash/ABase.h"
 
 namespace Serialization::detail_::Hash {
+/// Way of processing bytes in CrcSoftwareTpl
+enum class CrcMethod {
+    /// 8 shifts with a branch per byte, no tables
+    Bitwise,
+    /// One lookup per byte, 256-entry table
+    Table,
+    /// Four bytes per step, four 256-entry tables, for larger buffers
+    Slicing4
+};
+
 /**
- * @class CrcSoftware
- * @brief Calculates CRC in software
+ * @brief CRC model parameters
+ * @tparam T Register type, its width is the CRC width
+ * @tparam Poly Polynomial, bit-reversed if Reflected
+ * @tparam Init Initial register value
+ * @tparam Reflected Bytes enter LSB first (and the register shifts right)
+ * @tparam XorOut Value xor-ed into the result
+ */
+template<typename T, T Poly, T Init, bool Reflected, T XorOut>
+struct CrcParameters {
+    using Type = T;
+    static constexpr T k_poly = Poly;
+    static constexpr T k_init = Init;
+    static constexpr bool k_reflected = Reflected;
+    static constexpr T k_xorOut = XorOut;
+    static constexpr unsigned int k_width = std::numeric_limits< T >::digits;
+};
+
+/// Supported CRC models, check values are of "123456789"
+namespace Crc {
+    /// CRC-8, poly 0x07, check 0xF4
+    using Crc8 = CrcParameters< uint8_t, 0x07, 0x00, false, 0x00 >;
+    /// CRC-16/CCITT (CCITT-FALSE), poly 0x1021, init 0xFFFF, check 0x29B1
+    using Ccitt16 = CrcParameters< uint16_t, 0x1021, 0xFFFF, false, 0x0000 >;
+    /// CRC-32 (Ethernet, zlib), poly 0x04C11DB7 reflected, check 0xCBF43926
+    using Crc32 = CrcParameters< uint32_t, 0xEDB88320, 0xFFFFFFFF, true, 0xFFFFFFFF >;
+}
+
+namespace detail_ {
+/// Register after one byte of zeros, bitwise
+template<typename P>
+constexpr typename P::Type crcShift(typename P::Type crc) {
+    using T = typename P::Type;
+    constexpr T top = T{ 1 } << ( P::k_width - 1 );
+    for ( uint8_t i = 0; i < 8; ++i ) {
+        if constexpr ( P::k_reflected )
+            crc = ( crc & 1 ) ?static_cast< T >( ( crc >> 1 ) ^ P::k_poly ) :static_cast< T >( crc >> 1 );
+        else
+            crc = ( crc & top ) ?static_cast< T >( ( crc << 1 ) ^ P::k_poly ) :static_cast< T >( crc << 1 );
+    }
+    return crc;
+}
+
+/// Top byte of the register for the not reflected model, low byte otherwise
+template<typename P>
+constexpr uint8_t crcIndex(typename P::Type crc) {
+    if constexpr ( P::k_reflected )
+        return static_cast< uint8_t >( crc );
+    else
+        return static_cast< uint8_t >( crc >> ( P::k_width - 8 ) );
+}
+
+/// Register shifted by one byte, the leaving byte dropped
+template<typename P>
+constexpr typename P::Type crcShiftOut(typename P::Type crc) {
+    if constexpr ( P::k_width == 8 )
+        return 0;
+    else if constexpr ( P::k_reflected )
+        return static_cast< typename P::Type >( crc >> 8 );
+    else
+        return static_cast< typename P::Type >( crc << 8 );
+}
+
+template<typename P>
+using CrcTable = std::array< typename P::Type, 256 >;
+
+/**
+ * @brief Slicing tables, generated at compile time
+ * @details Table 0 is the classic one: crc = shiftOut(crc) ^ T0[index(crc) ^ byte].
+ *          Table k passes a byte through k more zero bytes: Tk[x] = shiftOut(Tk-1[x]) ^ T0[index(Tk-1[x])].
  */
-class CrcSoftware final : public ABase {
-    // Polynomial CRC-8: x^8 + x^2 + x + 1 (0x07)
-    static constexpr uint8_t CRC8_POLY = 0x07;
-    
-    uint8_t m_crc = 0;
-
-    void restart() {
-        m_crc = 0;
+template<typename P, size_t Count>
+constexpr std::array< CrcTable< P >, Count > makeCrcTables() {
+    using T = typename P::Type;
+    std::array< CrcTable< P >, Count > tables = { };
+    for ( size_t x = 0; x < 256; ++x ) {
+        const T aligned = P::k_reflected ?static_cast< T >( x ) :static_cast< T >( static_cast< T >( x ) << ( P::k_width - 8 ) );
+        tables[ 0 ][ x ] = crcShift< P >( aligned );
     }
+    for ( size_t k = 1; k < Count; ++k )
+        for ( size_t x = 0; x < 256; ++x ) {
+            const T previous = tables[ k - 1 ][ x ];
+            tables[ k ][ x ] = crcShiftOut< P >( previous ) ^ tables[ 0 ][ crcIndex< P >( previous ) ];
+        }
+    return tables;
+}
+
+template<typename P, size_t Count>
+struct CrcTables {
+    static constexpr std::array< CrcTable< P >, Count > k_value = makeCrcTables< P, Count >( );
+};
+} // namespace detail_
+
+/**
+ * @class CrcSoftwareTpl
+ * @brief Calculates CRC in software
+ * @details All methods give the same value, they differ in speed and flash:
+ *          Bitwise 8 branches per byte, Table one lookup per byte, Slicing4 four lookups per 4 bytes.
+ *          Tables take 256 entries of the CRC width each.
+ * @tparam Method Way of processing bytes
+ * @tparam Parameters CRC model, CRC-8 by default
+ */
+template<CrcMethod Method = CrcMethod::Table, typename Parameters = Crc::Crc8>
+class CrcSoftwareTpl final : public ABase< CrcSoftwareTpl< Method, Parameters >, typename Parameters::Type > {
+    using Base = ABase< CrcSoftwareTpl< Method, Parameters >, typename Parameters::Type >;
+    using Type = typename Parameters::Type;
+    using Tables = detail_::CrcTables< Parameters, ( CrcMethod::Slicing4 == Method ) ?4 :1 >;
+    static_assert( Parameters::k_width >= 8 && Parameters::k_width <= 32, "CRC width out of range" );
+    static_assert( CrcMethod::Slicing4 != Method || !Parameters::k_reflected || 32 == Parameters::k_width, "Reflected slicing only for CRC-32" );
+
+    Type m_crc = Parameters::k_init;
 
     void add(uint8_t data) {
-        m_crc ^= data;
-        for (uint8_t i = 0; i < 8; ++i) {
-            if (m_crc & 0x80) {
-                m_crc = (m_crc << 1) ^ CRC8_POLY;
-            } else {
-                m_crc <<= 1;
-            }
+        if constexpr ( CrcMethod::Bitwise == Method ) {
+            const Type aligned = Parameters::k_reflected ?data :static_cast< Type >( static_cast< Type >( data ) << ( Parameters::k_width - 8 ) );
+            m_crc = detail_::crcShift< Parameters >( m_crc ^ aligned );
+        } else {
+            m_crc = detail_::crcShiftOut< Parameters >( m_crc ) ^ Tables::k_value[ 0 ][ detail_::crcIndex< Parameters >( m_crc ) ^ data ];
+        }
+    }
+
+    /**
+     * @brief Four bytes at once, each byte through its own table
+     * @details The register is xor-ed into the 32-bit word it overlaps, then every byte of the word
+     *          is looked up in the table of the number of bytes still following it.
+     */
+    void add4(const uint8_t *data) {
+        const auto &t = Tables::k_value;
+        uint32_t word;
+        if constexpr ( Parameters::k_reflected ) {
+            word = m_crc ^ ( data[ 0 ] | data[ 1 ] << 8 | data[ 2 ] << 16 | static_cast< uint32_t >( data[ 3 ] ) << 24 );
+            m_crc = t[ 3 ][ word & 0xFF ] ^ t[ 2 ][ ( word >> 8 ) & 0xFF ] ^ t[ 1 ][ ( word >> 16 ) & 0xFF ] ^ t[ 0 ][ word >> 24 ];
+        } else {
+            word = ( static_cast< uint32_t >( m_crc ) << ( 32 - Parameters::k_width ) )
+                ^ ( static_cast< uint32_t >( data[ 0 ] ) << 24 | data[ 1 ] << 16 | data[ 2 ] << 8 | data[ 3 ] );
+            m_crc = t[ 3 ][ word >> 24 ] ^ t[ 2 ][ ( word >> 16 ) & 0xFF ] ^ t[ 1 ][ ( word >> 8 ) & 0xFF ] ^ t[ 0 ][ word & 0xFF ];
         }
     }
 
 public:
+    using Base::update;
+
+    /// Start a new CRC
+    void init() {
+        m_crc = Parameters::k_init;
+    }
+
     /**
-     * @brief Calculate CRC for a data buffer
+     * @brief Add a piece of data to the CRC
      * @param data Pointer to data
      * @param size Size in bytes
-     * @return CRC value
      */
-	uint8_t calculate(PackedData const& data) {
-        restart();
-        for (size_t i = 0; i < data.size(); ++i) {
-            add(data[i]);
+	void update(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t i = 0;
+        if constexpr ( CrcMethod::Slicing4 == Method ) {
+            for (; i + 4 <= size; i += 4) {
+                add4(bytes + i);
+            }
+        }
+        for (; i < size; ++i) {
+            add(bytes[i]);
         }
-        return m_crc;
 	}
+
+    /// CRC of all data since init()
+    Type finalize() const {
+        return m_crc ^ Parameters::k_xorOut;
+    }
 };
+
+/// CRC-8 with a lookup table
+using CrcSoftware = CrcSoftwareTpl< >;
+/// CRC-16/CCITT with a lookup table
+using Crc16Software = CrcSoftwareTpl< CrcMethod::Table, Crc::Ccitt16 >;
+/// CRC-32 with slicing tables, 4 KB of flash
+using Crc32Software = CrcSoftwareTpl< CrcMethod::Slicing4, Crc::Crc32 >;
 } // namespace Serialization::detail_::Hash
@@ -1,29 +1,37 @@
 // src\Serialization\Hash\SumSoftware.h - simple software hash (sum)
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
-#include "Serialization/Config/DataFormat.h"
 #include "Serialization/Hash/ABase.h"
 
+namespace Serialization::detail_::Hash {
 /**
  * @class SumSoftware
  * @brief Simple hash calculation by summing bytes
  */
-namespace Serialization {
-namespace Hash {
-class SumSoftware {
+class SumSoftware final : public ABase< SumSoftware, uint8_t > {
+    uint8_t m_sum = 0;
+
 public:
+    using ABase::update;
+
+    /// Start a new sum
+    void init() {
+        m_sum = 0;
+    }
+
     /**
-     * @brief Calculate sum hash for a data buffer
+     * @brief Add bytes of a data buffer to the sum
      * @param data Pointer to data
      * @param size Size in bytes
-     * @return Hash value (sum of bytes)
      */
-    uint8_t calculate(const void* data, size_t size) const {
+    void update(const void* data, size_t size) {
         const uint8_t* bytes = static_cast<const uint8_t*>(data);
-        uint8_t sum = 0;
         for (size_t i = 0; i < size; ++i)
-            sum += bytes[i];
-        return sum;
+            m_sum += bytes[i];
+    }
+
+    /// Hash value (sum of bytes)
+    uint8_t finalize() const {
+        return m_sum;
     }
 };
-}
-}
+} // namespace Serialization::detail_::Hash
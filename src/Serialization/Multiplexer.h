@@ -0,0 +1,200 @@
+// src\Serialization\Multiplexer.h - several message types over one link: type id, varint length, per-type codec
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "Serialization/Codec/Bytes.h"
+#include "Serialization/Codec/Telemetry.h"
+#include "Serialization/Config/Hashing.h"
+#include "Serialization/Framing/Cobs.h"
+#include "Serialization/Framing/Raw.h"
+#include "Serialization/Hash/ABase.h"
+#include "Tool/Varint.h"
+
+namespace Serialization {
+/**
+ * @brief Message type of the Multiplexer
+ * @tparam Id Type id on the wire, unique within the Multiplexer
+ * @tparam Codec Codec of the values, see Codec/Telemetry.h
+ */
+template<uint8_t Id, typename Codec>
+struct Channel {
+    static constexpr uint8_t id = Id;
+    using codec = Codec;
+    using Type = typename Codec::Type;
+};
+
+/**
+ * @class MultiplexerTpl
+ * @brief Commands, configuration, logs and telemetry sharing one link
+ * @details Message: type id byte, varint payload length, payload by the codec of the type, hash of all of them.
+ *          Types are registered at compile time, the receiver dispatches through a table indexed by id
+ *          and built at compile time per handler: one load and one indirect call, no search.
+ *          Framing delimits the messages as for the Serializer: Framing::Cobs on a noisy stream;
+ *          with Framing::Raw messageSize() tells a byte-stream reader how much to collect.
+ * @tparam Hasher Type of the hasher concept, see Hash/ABase.h
+ * @tparam Framing Type of the framing concept, see Framing/Raw.h
+ * @tparam Channels Channel<> per message type
+ */
+template<typename Hasher, typename Framing, typename... Channels>
+class MultiplexerTpl {
+    static_assert( detail_::Hash::IsHasher< Hasher >::value, "Hasher does not satisfy the hasher concept" );
+    static_assert( sizeof...( Channels ) > 0, "No channels" );
+
+    using HashReturnType = typename Hasher::ReturnType;
+    using Segment = detail_::Framing::Segment;
+
+    static constexpr bool uniqueIds() {
+        const uint8_t ids[] = { Channels::id... };
+        for ( size_t i = 0; i < sizeof...( Channels ); ++i )
+            for ( size_t j = i + 1; j < sizeof...( Channels ); ++j )
+                if ( ids[ i ] == ids[ j ] )
+                    return false;
+        return true;
+    }
+    static_assert( uniqueIds( ), "Channel ids repeat" );
+
+    static constexpr size_t varintSize(size_t value) {
+        return ( value < 0x80 ) ?1 :1 + varintSize( value >> 7 );
+    }
+
+    /// Size of the hash on the wire
+    static constexpr size_t k_hashSize = sizeof( HashReturnType );
+
+public:
+    /// Largest payload of any channel
+    static constexpr size_t k_maxPayload = std::max( { Channels::codec::k_maxSize... } );
+    /// Largest type id, the size of the dispatch table
+    static constexpr uint8_t k_maxId = std::max( { Channels::id... } );
+    /// Longest type id and length
+    static constexpr size_t k_maxHeaderSize = 1 + varintSize( k_maxPayload );
+    /// Largest message before framing
+    static constexpr size_t k_maxMessageSize = k_maxHeaderSize + k_maxPayload + k_hashSize;
+    /// Largest message on the wire, e.g. the capacity of Framing::Cobs::Reader
+    static constexpr size_t k_maxWireSize = Framing::maxSize( k_maxMessageSize );
+
+private:
+    template<typename Handler>
+    using Decoder = bool(*)(const uint8_t *payload, size_t size, Handler &handler);
+
+    /// Decodes the payload of one channel and hands the value over
+    template<typename Handler, typename C>
+    static bool decode(const uint8_t *payload, size_t size, Handler &handler) {
+        typename C::Type value;
+        if ( !C::codec::decode( payload, size, &value ) )
+            return false;
+        handler( C{ }, value );
+        return true;
+    }
+
+    template<typename Handler>
+    static constexpr std::array< Decoder< Handler >, k_maxId + 1 > makeTable() {
+        std::array< Decoder< Handler >, k_maxId + 1 > table = { };
+        ( ..., ( table[ Channels::id ] = &decode< Handler, Channels > ) );
+        return table;
+    }
+
+    /// Decoder per type id, nullptr for an unknown one
+    template<typename Handler>
+    static constexpr std::array< Decoder< Handler >, k_maxId + 1 > k_table = makeTable< Handler >( );
+
+    /// Hasher for calculating data checksum
+    Hasher m_hasher;
+
+public:
+    /// Hasher initialization
+    void begin() {
+        m_hasher.begin( );
+    }
+
+    /**
+     * @brief Encodes a value of the channel and sends it to stream as one message
+     * @tparam C Channel of the value
+     * @tparam T Output stream type
+     * @param value Value to send
+     * @param stream Pointer to output stream
+     * @return true if data was sent successfully, false if the value does not fit or the stream is full
+     */
+    template<typename C, typename T>
+    bool send(typename C::Type const& value, T *stream) {
+        static_assert( ( ... || std::is_same_v< C, Channels > ), "Channel is not registered" );
+        // Payload first, the header goes right before it, so the message is contiguous
+        uint8_t buffer[ k_maxHeaderSize + k_maxPayload ];
+        uint8_t *payload = buffer + k_maxHeaderSize;
+        const size_t size = C::codec::encode( value, payload );
+        if ( size > C::codec::k_maxSize )
+            return false;
+        uint8_t header[ k_maxHeaderSize ] = { C::id };
+        const size_t headerSize = 1 + Tool::Varint::encode( static_cast< uint32_t >( size ), header + 1 );
+        uint8_t *message = payload - headerSize;
+        memcpy( message, header, headerSize );
+        const HashReturnType hash = m_hasher.calculate( message, headerSize + size );
+        return Framing::template write< k_maxMessageSize >( stream, Segment{ message, headerSize + size }, Segment{ &hash, sizeof( hash ) } );
+    }
+
+    /**
+     * @brief Size of a message by its first bytes
+     * @details Lets a byte-stream reader with Framing::Raw know how much to collect before dispatch()
+     * @param input First received bytes of the message
+     * @param size Number of received bytes
+     * @return Number of bytes of the whole message, 0 if the header is not complete yet,
+     *         above k_maxMessageSize if the header is malformed
+     */
+    static size_t messageSize(const uint8_t *input, size_t size) {
+        if ( size < 2 )
+            return 0;
+        uint32_t length = 0;
+        const size_t lengthSize = Tool::Varint::decode( input + 1, size - 1, &length );
+        if ( !lengthSize )
+            return ( size - 1 < Tool::Varint::maxSize< uint32_t >( ) ) ?0 :k_maxMessageSize + 1;
+        if ( length > k_maxPayload )
+            return k_maxMessageSize + 1;
+        return 1 + lengthSize + length + k_hashSize;
+    }
+
+    /**
+     * @brief Checks and decodes a message, calls the handler with its value
+     * @tparam Handler Callable handler(C channel, typename C::Type const& value), overloaded or generic
+     * @param input Pointer to input buffer, a framing that encodes (Framing::Cobs) decodes it in place
+     * @param size Size of input buffer
+     * @param handler Receives the value, the channel tag selects the overload
+     * @return false if damaged, of an unknown type or malformed for its codec
+     */
+    template<typename Handler>
+    bool dispatch(void *input, size_t size, Handler &&handler) {
+        return dispatchMessage( Framing::unwrap( static_cast< uint8_t *>( input ), &size ), size, handler );
+    }
+
+    /// Read-only input, for a framing that leaves the bytes as they are (Framing::Raw)
+    template<typename Handler>
+    bool dispatch(const void *input, size_t size, Handler &&handler) {
+        return dispatchMessage( Framing::unwrap( static_cast< const uint8_t *>( input ), &size ), size, handler );
+    }
+
+private:
+    /// Message after the framing, nullptr if the framing found it malformed
+    template<typename Handler>
+    bool dispatchMessage(const uint8_t *bytes, size_t size, Handler &handler) {
+        using H = std::remove_reference_t< Handler >;
+        if ( !bytes )
+            return false;
+        const size_t total = messageSize( bytes, size );
+        if ( !total || total > size )
+            return false;
+        // Header is valid once the size is known
+        uint32_t length = 0;
+        const size_t headerSize = 1 + Tool::Varint::decode( bytes + 1, size - 1, &length );
+        HashReturnType hashFromInput;
+        memcpy( &hashFromInput, bytes + headerSize + length, sizeof( hashFromInput ) );
+        if ( m_hasher.calculate( bytes, headerSize + length ) != hashFromInput )
+            return false;
+        const uint8_t id = bytes[ 0 ];
+        if ( id > k_maxId || !k_table< H >[ id ] )
+            return false;
+        return k_table< H >[ id ]( bytes + headerSize, length, handler );
+    }
+};
+} // namespace Serialization
@@ -0,0 +1,78 @@
+// src\Serialization\Packing\Batch.h - packing of many frames with a fixed stride
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "Serialization/Config/DataFormat.h"
+
+namespace Serialization::detail_::Packing {
+namespace detail_ {
+// Packer provides its own batch kernels
+template<typename T, typename = void>
+struct HasBatch : std::false_type {};
+template<typename T>
+struct HasBatch< T, std::void_t< 
+        decltype( T::packBatch( static_cast< const RawData *>( nullptr ), size_t{ }, static_cast< uint8_t *>( nullptr ), size_t{ } ) )
+        , decltype( T::unpackBatch( static_cast< const uint8_t *>( nullptr ), size_t{ }, size_t{ }, static_cast< RawData *>( nullptr ) ) )
+    > > : std::true_type {};
+// Packer unpacks in place from a view
+template<typename T, typename = void>
+struct HasView : std::false_type {};
+template<typename T>
+struct HasView< T, std::void_t< 
+        decltype( T::unpack( std::declval< PackedView >( ), static_cast< RawData *>( nullptr ) ) )
+    > > : std::true_type {};
+} // namespace detail_
+
+/**
+ * @struct Batch
+ * @brief Packs and unpacks frames laid out back-to-back with a fixed stride
+ * @details Uses Packing::packBatch()/unpackBatch() when the packer provides them,
+ *          e.g. SIMD kernels in a host build, otherwise loops over pack()/unpack().
+ *          Stride is sizeof(PackedData) plus whatever the caller places after each frame.
+ * @tparam Packing Packer type
+ */
+template<typename Packing>
+struct Batch {
+    /**
+     * @brief Packs frames into the output buffer
+     * @param input Input frames
+     * @param count Number of frames
+     * @param output Output buffer, at least count * stride bytes
+     * @param stride Distance between frames in the output buffer
+     */
+    static void pack(RawData const* input, size_t count, uint8_t *output, size_t stride) {
+        if constexpr ( detail_::HasBatch< Packing >::value ) {
+            Packing::packBatch( input, count, output, stride );
+        } else {
+            PackedData buffer;
+            for ( size_t i = 0; i < count; ++i, output += stride ) {
+                Packing::pack( input[ i ], &buffer );
+                memcpy( output, buffer.data( ), sizeof( buffer ) );
+            }
+        }
+    }
+
+    /**
+     * @brief Unpacks frames from the input buffer
+     * @param input Input buffer, at least count * stride bytes
+     * @param count Number of frames
+     * @param stride Distance between frames in the input buffer
+     * @param output Output frames
+     */
+    static void unpack(const uint8_t *input, size_t count, size_t stride, RawData *output) {
+        if constexpr ( detail_::HasBatch< Packing >::value ) {
+            Packing::unpackBatch( input, count, stride, output );
+        } else if constexpr ( detail_::HasView< Packing >::value ) {
+            for ( size_t i = 0; i < count; ++i, input += stride )
+                Packing::unpack( PackedView( input ), &output[ i ] );
+        } else {
+            PackedData buffer;
+            for ( size_t i = 0; i < count; ++i, input += stride ) {
+                memcpy( buffer.data( ), input, sizeof( buffer ) );
+                Packing::unpack( buffer, &output[ i ] );
+            }
+        }
+    }
+};
+} // namespace Serialization::detail_::Packing
@@ -0,0 +1,193 @@
+// src\Serialization\Packing\DeltaVarint.h - delta + zigzag + varint coding of slowly changing data
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <algorithm>
+#include "Serialization/Config/DataFormat.h"
+#include "Serialization/Packing/viaAccumulator.h"
+#include "Tool/CompileTimeConfigure.h"
+#include "Tool/Varint.h"
+
+namespace Serialization::detail_::Packing {
+/**
+ * @class DeltaVarintTpl
+ * @brief Stateful packing that sends differences against the previous frame
+ * @details Frame kinds, selected by the first byte:
+ *          - Keyframe: all elements bit-packed by KeyframePacking, sent first and every KeyframePeriod frames
+ *          - Delta: bitmask of changed elements, then zigzag-varint difference of each changed element
+ *          An unchanged frame takes 1 + (amount + 7) / 8 bytes, a small change adds one byte per element.
+ *          The decoder rejects deltas until it has seen a keyframe, the periodic keyframe resynchronizes it.
+ * @tparam KeyframePacking Fixed-width packer for keyframes
+ * @tparam KeyframePeriod Number of frames between keyframes, including the keyframe
+ */
+template<typename KeyframePacking = viaAccumulator, unsigned int KeyframePeriod = 16>
+class DeltaVarintTpl {
+    using PackingPolicy = Tool::CompileTimeConfigure;
+    using InputType = PackingPolicy::InputType;
+    // Difference of two normalized values and its zigzag form
+    using Difference = int32_t;
+    using Unsigned = uint32_t;
+    static_assert( PackingPolicy::getOutputBitCount( ) < std::numeric_limits< Difference >::digits, "Element too wide for difference" );
+    static_assert( KeyframePeriod > 0, "Keyframe period must be positive" );
+
+    static constexpr size_t k_amount = PackingPolicy::getInputAmount( );
+    /// Size of the bitmask of changed elements
+    static constexpr size_t k_maskSize = ( k_amount + 7 ) / 8;
+    /// Normalized elements of the last sent frame
+    InputType m_sent[ k_amount ] = { };
+    /// Frames since the last keyframe, starts expired to send a keyframe first
+    unsigned int m_sinceKeyframe = KeyframePeriod;
+    /// Normalized elements of the last received frame
+    InputType m_received[ k_amount ] = { };
+    /// Decoder has a reference frame
+    bool m_synchronized = false;
+
+public:
+    /// Frame kind, first byte of the frame
+    enum Kind : uint8_t {
+        Keyframe = 0,
+        Delta = 1
+    };
+
+    /**
+     * @brief Largest delta body: every element changed by the full range
+     * @details A difference takes the bits of its element and the sign, so its zigzag varint
+     *          takes (bits + 1 + 6) / 7 bytes, not the size of the widest Unsigned.
+     */
+    static constexpr size_t maxDeltaSize() {
+        size_t size = k_maskSize;
+        for ( size_t i = 0; i < k_amount; ++i )
+            size += ( PackingPolicy::getBitCount( i ) + 1 + 6 ) / 7;
+        return size;
+    }
+    static constexpr size_t k_maxDeltaSize = maxDeltaSize( );
+    /// Maximum size of an encoded frame in bytes
+    static constexpr size_t k_maxSize = 1 + std::max( sizeof( PackedData ), k_maxDeltaSize );
+
+    /// Send a keyframe next and forget the received reference
+    void reset() {
+        m_sinceKeyframe = KeyframePeriod;
+        m_synchronized = false;
+    }
+
+    /// Use the frame sent by another packer as reference for the next delta
+    void reference(RawData const& input) {
+        for ( size_t i = 0; i < k_amount; ++i )
+            m_sent[ i ] = PackingPolicy::normalize( i, input[ i ] );
+    }
+
+    /// Use the frame received by another packer as reference for the next delta
+    void synchronize(RawData const& input) {
+        for ( size_t i = 0; i < k_amount; ++i )
+            m_received[ i ] = PackingPolicy::normalize( i, input[ i ] );
+        m_synchronized = true;
+    }
+
+    /// Forget the received reference, deltas are rejected until the next keyframe or synchronize()
+    void desynchronize() {
+        m_synchronized = false;
+    }
+
+    /**
+     * @brief Packs input RawData against the previous frame
+     * @param input Input data array
+     * @param output Output buffer, at least k_maxSize bytes
+     * @return Number of bytes written
+     */
+    size_t pack(RawData const& input, uint8_t *output) {
+        if ( m_sinceKeyframe >= KeyframePeriod ) {
+            m_sinceKeyframe = 1;
+            reference( input );
+            output[ 0 ] = Keyframe;
+            PackedData buffer;
+            KeyframePacking::pack( input, &buffer );
+            std::copy( buffer.begin( ), buffer.end( ), output + 1 );
+            return 1 + sizeof( buffer );
+        }
+        ++m_sinceKeyframe;
+        output[ 0 ] = Delta;
+        return 1 + packDelta( input, output + 1 );
+    }
+
+    /**
+     * @brief Packs only the delta body: bitmask and varints, without kind byte and keyframes
+     * @details The input becomes the reference for the next delta
+     * @param input Input data array
+     * @param output Output buffer, at least k_maxDeltaSize bytes
+     * @return Number of bytes written
+     */
+    size_t packDelta(RawData const& input, uint8_t *output) {
+        uint8_t *mask = output;
+        std::fill( mask, mask + k_maskSize, 0 );
+        size_t size = k_maskSize;
+        for ( size_t i = 0; i < k_amount; ++i ) {
+            const InputType value = PackingPolicy::normalize( i, input[ i ] );
+            const Difference difference = static_cast< Difference >( value ) - m_sent[ i ];
+            if ( !difference )
+                continue;
+            mask[ i / 8 ] |= 1 << ( i % 8 );
+            size += Tool::Varint::encode( Tool::Varint::zigzag( difference ), output + size );
+            m_sent[ i ] = value;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Unpacks one frame into RawData array
+     * @param input Input buffer
+     * @param size Size of input buffer
+     * @param output Pointer to output data array
+     * @return Number of bytes consumed, 0 if malformed or not synchronized yet
+     */
+    size_t unpack(const uint8_t *input, size_t size, RawData *output) {
+        if ( !size )
+            return 0;
+        if ( Keyframe == input[ 0 ] ) {
+            PackedData buffer;
+            if ( size < 1 + sizeof( buffer ) )
+                return 0;
+            std::copy( input + 1, input + 1 + sizeof( buffer ), buffer.begin( ) );
+            KeyframePacking::unpack( buffer, output );
+            synchronize( *output );
+            return 1 + sizeof( buffer );
+        }
+        if ( Delta != input[ 0 ] )
+            return 0;
+        const size_t read = unpackDelta( input + 1, size - 1, output );
+        return read ?1 + read :0;
+    }
+
+    /**
+     * @brief Unpacks only the delta body produced by packDelta()
+     * @param input Input buffer
+     * @param size Size of input buffer
+     * @param output Pointer to output data array
+     * @return Number of bytes consumed, 0 if malformed or not synchronized yet
+     */
+    size_t unpackDelta(const uint8_t *input, size_t size, RawData *output) {
+        if ( !m_synchronized || size < k_maskSize )
+            return 0;
+        const uint8_t *mask = input;
+        size_t offset = k_maskSize;
+        InputType values[ k_amount ];
+        for ( size_t i = 0; i < k_amount; ++i ) {
+            values[ i ] = m_received[ i ];
+            if ( !( mask[ i / 8 ] & ( 1 << ( i % 8 ) ) ) )
+                continue;
+            Unsigned zigzag;
+            const size_t read = Tool::Varint::decode( input + offset, size - offset, &zigzag );
+            if ( !read )
+                return 0;
+            offset += read;
+            values[ i ] = static_cast< InputType >( m_received[ i ] + Tool::Varint::unzigzag( zigzag ) );
+        }
+        // Commit only a complete frame
+        for ( size_t i = 0; i < k_amount; ++i ) {
+            m_received[ i ] = values[ i ];
+            ( *output )[ i ] = PackingPolicy::denormalize( i, values[ i ] );
+        }
+        return offset;
+    }
+};
+
+/// Delta coding with the default keyframe packer and period
+using DeltaVarint = DeltaVarintTpl< >;
+} // namespace Serialization::detail_::Packing
@@ -6,9 +6,10 @@
 namespace Serialization::detail_::Packing {
 // The class is designed only for the basic config and was not tested with other configs
 static_assert( std::is_same_v< Tool::CompileTimeConfigure::InputType, unsigned short >, "Allowed for only basic config" );
+static_assert( Tool::CompileTimeConfigure::isUniform( ), "Allowed for only basic config" );
 static_assert( Tool::CompileTimeConfigure::getInputAmount( ) == 4, "Allowed for only basic config" );
 static_assert( Tool::CompileTimeConfigure::getOutputBitCount( ) == 10, "Allowed for only basic config" );
-static_assert( Tool::CompileTimeConfigure::denormalize( 0 ) == 0, "Allowed for only basic config" );
+static_assert( Tool::CompileTimeConfigure::denormalize( 0, 0 ) == 0, "Allowed for only basic config" );
 
 /**
  * @struct Ordinary
@@ -36,13 +37,11 @@ struct Ordinary {
             // Place lower bits into the current byte
             buffer[byte_pos] |= (val & 0x3FF) << bit_shift;
 
-            // If value crosses byte boundary, place upper bits into next byte
-            if (bit_shift > 2 && byte_pos + 1 < buffer.size()) {
+            // 10 bits always cross the byte boundary, place upper bits into next byte
+            if (byte_pos + 1 < buffer.size()) {
                 buffer[byte_pos + 1] |= (val & 0x3FF) >> (8 - bit_shift);
             }
         }
-        // Explicitly clear unused bits in the last byte. Leave only the lowest 4 bits.
-        buffer.back() &= 0x0F;
     }
 
     /**
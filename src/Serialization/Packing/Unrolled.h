@@ -0,0 +1,141 @@
+// src\Serialization\Packing\Unrolled.h - packing functions generated at compile time
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+#include "Serialization/Config/DataFormat.h"
+#include "Tool/CompileTimeConfigure.h"
+#include "Tool/Span.h"
+
+namespace Serialization::detail_::Packing {
+/**
+ * @class UnrolledTpl
+ * @brief Fully unrolled packing and unpacking for any configuration
+ * @details Byte index, shift and mask of each element are computed at compile time from
+ *          the schema widths PackingPolicy::getBitCount() and getInputAmount(), so pack and unpack are
+ *          straight-line code without loops and branches, also for heterogeneous schemas.
+ *          Bit layout is the same as in viaBitReader (LSB first), the packers are interchangeable.
+ * @tparam PackingPolicy Configuration, Tool::CompileTimeConfigure by default
+ */
+template<typename PackingPolicy = Tool::CompileTimeConfigure>
+class UnrolledTpl {
+    using InputType = typename PackingPolicy::InputType;
+    using Word = uint64_t;
+
+    static constexpr size_t k_amount = PackingPolicy::getInputAmount( );
+    static constexpr size_t k_packedSize = PackingPolicy::packedSize( );
+    // Widest element with its shift must fit into the word
+    static_assert( PackingPolicy::getOutputBitCount( ) + 7 <= std::numeric_limits< Word >::digits, "Element too wide for word" );
+
+    /// First bit of the element in the packed data
+    static constexpr size_t firstBit(size_t element) {
+        return PackingPolicy::getBitOffset( element );
+    }
+
+    /// Number of bits of the element
+    static constexpr size_t bitCount(size_t element) {
+        return PackingPolicy::getBitCount( element );
+    }
+
+    /// Mask of the element
+    static constexpr Word mask(size_t element) {
+        return ( Word{ 1 } << bitCount( element ) ) - 1;
+    }
+
+    /// Part of the element that falls into the byte, zero if none
+    template<size_t Byte, size_t Element>
+    static constexpr Word contribution(Word value) {
+        constexpr size_t first = firstBit( Element );
+        constexpr size_t last = first + bitCount( Element );
+        if constexpr ( last <= Byte * 8 || first >= Byte * 8 + 8 )
+            return 0;
+        else if constexpr ( first >= Byte * 8 )
+            return value << ( first - Byte * 8 );
+        else
+            return value >> ( Byte * 8 - first );
+    }
+
+    /// Assemble one output byte from all elements overlapping it
+    template<size_t Byte, size_t... Element>
+    static constexpr uint8_t gatherByte(Word const (&values)[k_amount], std::index_sequence<Element...>) {
+        return static_cast< uint8_t >( ( contribution< Byte, Element >( values[ Element ] ) | ... ) );
+    }
+
+    template<size_t... Byte>
+    static void packBytes(Word const (&values)[k_amount], uint8_t *out, std::index_sequence<Byte...>) {
+        ( ( out[ Byte ] = gatherByte< Byte >( values, std::make_index_sequence< k_amount >( ) ) ), ... );
+    }
+
+    /// Read the bytes covering the element, shift and mask it
+    template<size_t Element, size_t... Byte>
+    static Word gatherElement(const uint8_t *in, std::index_sequence<Byte...>) {
+        constexpr size_t first = firstBit( Element );
+        return ( ( ( static_cast< Word >( in[ first / 8 + Byte ] ) << ( 8 * Byte ) ) | ... ) >> ( first % 8 ) ) & mask( Element );
+    }
+
+    template<size_t Element>
+    static Word unpackElement(const uint8_t *in) {
+        // Number of bytes covered by the element
+        constexpr size_t bytes = ( firstBit( Element ) % 8 + bitCount( Element ) + 7 ) / 8;
+        return gatherElement< Element >( in, std::make_index_sequence< bytes >( ) );
+    }
+
+    template<typename Output, size_t... Element>
+    static void unpackElements(const uint8_t *in, Output &output, std::index_sequence<Element...>) {
+        ( ( output[ Element ] = PackingPolicy::denormalize( Element, unpackElement< Element >( in ) ) ), ... );
+    }
+
+    template<typename Input, size_t... Element>
+    static void normalizeElements(Input const& input, Word (&values)[k_amount], std::index_sequence<Element...>) {
+        ( ( values[ Element ] = PackingPolicy::normalize( Element, input[ Element ] ) ), ... );
+    }
+
+public:
+    /// Input array type
+    using Input = std::array< InputType, k_amount >;
+
+    /**
+     * @brief Packs input array into packed buffer
+     * @tparam N Size of the packed buffer, padding after packedSize() is zeroed
+     * @param input Input data array
+     * @param buffer Pointer to output packed buffer
+     */
+    template<size_t N>
+    static void pack(Input const& input, std::array< uint8_t, N > *buffer) {
+        static_assert( N >= k_packedSize, "Packed buffer too small" );
+        Word values[ k_amount ];
+        normalizeElements( input, values, std::make_index_sequence< k_amount >( ) );
+        packBytes( values, buffer ->data( ), std::make_index_sequence< k_packedSize >( ) );
+        if constexpr ( N > k_packedSize )
+            std::fill( buffer ->begin( ) + k_packedSize, buffer ->end( ), 0 );
+    }
+
+    /**
+     * @brief Unpacks packed buffer into output array
+     * @tparam N Size of the packed buffer
+     * @param buffer Input packed buffer
+     * @param output Pointer to output data array
+     */
+    template<size_t N>
+    static void unpack(std::array< uint8_t, N > const& buffer, Input *output) {
+        static_assert( N >= k_packedSize, "Packed buffer too small" );
+        unpackElements( buffer.data( ), *output, std::make_index_sequence< k_amount >( ) );
+    }
+
+    /**
+     * @brief Unpacks the packed bytes where they are, e.g. a PackedView of a received message
+     * @tparam N Size of the view
+     * @param buffer View of the packed bytes
+     * @param output Pointer to output data array
+     */
+    template<size_t N>
+    static void unpack(Tool::Span< const uint8_t, N > buffer, Input *output) {
+        static_assert( N >= k_packedSize, "Packed buffer too small" );
+        unpackElements( buffer.data( ), *output, std::make_index_sequence< k_amount >( ) );
+    }
+};
+
+/// Unrolled packing for the user configuration from Config.h
+using Unrolled = UnrolledTpl< >;
+} // namespace Serialization::detail_::Packing
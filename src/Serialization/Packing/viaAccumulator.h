@@ -0,0 +1,75 @@
+// src\Serialization\Packing\viaAccumulator.h - packing functions using a shift accumulator
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <limits>
+#include "Serialization/Config/DataFormat.h"
+#include "Tool/CompileTimeConfigure.h"
+
+namespace Serialization::detail_::Packing {
+/**
+ * @class viaAccumulator
+ * @brief Word-at-a-time packing and unpacking through a shift accumulator
+ * @details Whole values are shifted into a 64-bit accumulator and full bytes are flushed,
+ *          so the cost depends on the number of bytes, not bits.
+ *          Each element takes the bits of its own range from the schema.
+ *          Bit layout is the same as in viaBitReader (LSB first), the packers are interchangeable.
+ */
+class viaAccumulator {
+    using PackingPolicy = Tool::CompileTimeConfigure;
+    using Accumulator = uint64_t;
+
+    // Up to 7 pending bits plus the widest element must fit into the accumulator
+    static_assert( PackingPolicy::getOutputBitCount( ) + 7 <= std::numeric_limits< Accumulator >::digits, "Element too wide for accumulator" );
+
+public:
+    /**
+     * @brief Packs input RawData into PackedData buffer
+     * @param input Input data array
+     * @param buffer Pointer to output packed buffer
+     */
+    static void pack(RawData const& input, PackedData *buffer) {
+        uint8_t *out = buffer ->data( );
+        uint8_t *const end = out + buffer ->size( );
+        Accumulator accumulator = 0;
+        unsigned int pending = 0;
+        for ( size_t i = 0; i < input.size( ); ++i ) {
+            accumulator |= static_cast< Accumulator >( PackingPolicy::normalize( i, input[ i ] ) ) << pending;
+            pending += PackingPolicy::getBitCount( i );
+            // Flush full bytes
+            while ( pending >= 8 ) {
+                *out++ = static_cast< uint8_t >( accumulator );
+                accumulator >>= 8;
+                pending -= 8;
+            }
+        }
+        // Last incomplete byte
+        if ( pending )
+            *out++ = static_cast< uint8_t >( accumulator );
+        // Padding
+        while ( out < end )
+            *out++ = 0;
+    }
+
+    /**
+     * @brief Unpacks PackedData buffer into RawData array
+     * @param buffer Input packed buffer, PackedData or a view of received bytes
+     * @param output Pointer to output data array
+     */
+    static void unpack(PackedView buffer, RawData *output) {
+        const uint8_t *in = buffer.data( );
+        Accumulator accumulator = 0;
+        unsigned int available = 0;
+        for ( size_t i = 0; i < output ->size( ); ++i ) {
+            const unsigned int bitCount = PackingPolicy::getBitCount( i );
+            // Refill only the bytes needed for the current element
+            while ( available < bitCount ) {
+                accumulator |= static_cast< Accumulator >( *in++ ) << available;
+                available += 8;
+            }
+            // Bits of the next elements are masked out
+            ( *output )[ i ] = PackingPolicy::denormalize( i, static_cast< PackingPolicy::CapacityCompiler >( accumulator ) );
+            accumulator >>= bitCount;
+            available -= bitCount;
+        }
+    }
+};
+} // namespace Serialization::detail_::Packing
@@ -99,7 +99,7 @@ struct BitAddress
 /**
  * @class viaBitReader
  * @brief Bit-level packing and unpacking using BitAddress helper
- * @details Packs and unpacks RawData and PackedData using arbitrary bit widths.
+ * @details Packs and unpacks RawData and PackedData using arbitrary bit widths, per element of the schema.
  */
 class viaBitReader {
     using PackingPolicy = Tool::CompileTimeConfigure;
@@ -113,24 +113,24 @@ public:
         buffer ->fill( 0 );
         detail_::BitAddress bitwriter;
         bitwriter.setBuffer( buffer ->data( ) );
-        for ( auto val : input ) {
-            PackingPolicy::InputType clampedValue = PackingPolicy::normalize( val );
-            bitwriter.write( &clampedValue, PackingPolicy::getOutputBitCount( ) );
+        for ( size_t i = 0; i < input.size( ); ++i ) {
+            PackingPolicy::InputType clampedValue = PackingPolicy::normalize( i, input[ i ] );
+            bitwriter.write( &clampedValue, PackingPolicy::getBitCount( i ) );
         }
     }
 
     /**
      * @brief Unpacks PackedData buffer into RawData array using bit-level access
-     * @param buffer Input packed buffer
+     * @param buffer Input packed buffer, PackedData or a view of received bytes
      * @param output Pointer to output data array
      */
-    static void unpack(PackedData const& buffer, RawData *output) {
+    static void unpack(PackedView buffer, RawData *output) {
         detail_::BitAddress bitreader;
         bitreader.setBuffer( buffer.data( ) );
-        for ( auto& val : *output ) {
+        for ( size_t i = 0; i < output ->size( ); ++i ) {
             PackingPolicy::CapacityCompiler read;
-            bitreader.read( PackingPolicy::getOutputBitCount( ), &read );
-            val = PackingPolicy::denormalize( read );
+            bitreader.read( PackingPolicy::getBitCount( i ), &read );
+            ( *output )[ i ] = PackingPolicy::denormalize( i, read );
         }
     }
 };
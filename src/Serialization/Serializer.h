@@ -2,32 +2,321 @@
 #pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
 #include "Serialization/Config/DataFormat.h"
 #include "Serialization/Config/Hashing.h"
+#include "Serialization/Config/Frame.h"
+#include "Serialization/Config/Tag.h"
+#include "Serialization/Framing/Cobs.h"
+#include "Serialization/Framing/Raw.h"
+#include "Serialization/Framing/Resync.h"
+#include "Serialization/Hash/ABase.h"
 // #include "Serialization/Packing/Ordinary.h"
 #include "Serialization/Packing/viaBitReader.h"
+#include "Serialization/Packing/Batch.h"
+#include "Serialization/Packing/DeltaVarint.h"
 #include "Tool/Hexdumper.h"
 
 namespace Serialization {
 /**
- * @class Serializer
+ * @class SerializerTpl
  * @brief Converter between raw data and stream format with integrity check
  * @details:
  *          - Serialization: packs 4x10 bits + hash -> writes to stream
  *          - Deserialization: reads from buffer -> checks hash -> unpacks
+ *          All policies are resolved at compile time, no virtual calls on the path.
  * @note:
  *       - Only writes to stream during serialization
- *       - Reads from buffer (not stream) during deserialization 
+ *       - Reads from buffer (not stream) during deserialization, hashes and unpacks it in place
+ *       - Batch API packs many frames into one caller buffer and back, without framing
+ *       - Encoding::SuppressRepeats replaces unchanged frames by a one-byte token
+ *       - Encoding::Adaptive also picks the smallest of bit-packed, delta-varint and raw per frame
+ * @tparam Packer Fixed-width packer: pack(RawData const&, PackedData*) and unpack(PackedData or PackedView, RawData*)
+ * @tparam Hasher Type of the hasher concept, see Hash/ABase.h
+ * @tparam Framing Type of the framing concept, see Framing/Raw.h; Framing::Cobs makes the stream self-synchronizing
  */
-class Serializer {
-    using HashReturnType = detail_::HashReturnType;
-    using Packing = detail_::Packing::viaBitReader;
+template<typename Packer = detail_::Packing::viaBitReader, typename Hasher = detail_::Hasher, typename Framing = detail_::Framing::Raw>
+class SerializerTpl {
+    static_assert( detail_::Hash::IsHasher< Hasher >::value, "Hasher does not satisfy the hasher concept" );
+
+    using HashReturnType = typename Hasher::ReturnType;
+    using Packing = Packer;
+    using Batch = detail_::Packing::Batch< Packing >;
+    using Delta = detail_::Packing::DeltaVarint;
+    using PackingPolicy = Tool::CompileTimeConfigure;
+    using Segment = detail_::Framing::Segment;
+
+    /// Size of the hash on the wire
+    static constexpr size_t k_hashSize = sizeof( HashReturnType );
+    /// Payload of a raw message
+    static constexpr size_t k_rawSize = sizeof( RawData );
+    /// Frames between absolute (bit-packed or raw) messages, a lost delta is repaired by the next one
+    static constexpr unsigned int k_keyframePeriod = 16;
+    static_assert( Delta::k_maxDeltaSize <= detail_::Tag::k_maxDelta, "Delta length does not fit into tag" );
 
     /// Hasher for calculating data checksum
-    detail_::Hasher m_hasher;
+    Hasher m_hasher;
 
 public:
-    /// Hasher initialization
-    void begin() {
+    /// Size of one plain frame: packed data + hash
+    static constexpr size_t k_frameSize = sizeof( detail_::PackedData ) + k_hashSize;
+    /// Largest message of any encoding before framing
+    static constexpr size_t k_maxMessageSize = 1 + std::max( { sizeof( detail_::PackedData ), k_rawSize, Delta::k_maxDeltaSize } ) + k_hashSize;
+    /// Largest message on the wire, e.g. the capacity of Framing::Cobs::Reader
+    static constexpr size_t k_maxWireSize = Framing::maxSize( k_maxMessageSize );
+
+    /// Wire encoding of serialize() and deserialize()
+    enum class Encoding {
+        /// Packed data + hash, always k_frameSize bytes
+        Plain,
+        /// Tag byte first; an unchanged frame is sent as a one-byte repeat token
+        SuppressRepeats,
+        /// As SuppressRepeats, a changed frame is sent by the smallest codec
+        Adaptive
+    };
+
+private:
+    Encoding m_encoding = Encoding::Plain;
+    /// Last frame sent in full
+    RawData m_sent = { };
+    /// Repeat tokens sent since m_sent, k_maxRepeats forces a full frame
+    uint8_t m_repeats = detail_::Tag::k_maxRepeats;
+    /// Hash bits of m_sent carried by its repeat tokens
+    uint8_t m_sentCheck = 0;
+    /// Last frame received in full, valid if m_hasReceived
+    RawData m_received = { };
+    bool m_hasReceived = false;
+    /// Hash bits of m_received, a repeat token of another message does not match
+    uint8_t m_receivedCheck = 0;
+    /// Delta coder of Encoding::Adaptive, references follow every full frame
+    Delta m_delta;
+    /// Full frames sent since the last absolute one, starts expired
+    unsigned int m_sinceKeyframe = k_keyframePeriod;
+
+    /// Low bits of a message hash as carried by a repeat token
+    static uint8_t repeatCheck(HashReturnType hash) {
+        return static_cast< uint8_t >( hash ) & detail_::Tag::k_repeatCheck;
+    }
+
+    /// A full frame reached the stream, later repeat tokens and deltas refer to it
+    void commitSent(RawData const& input, HashReturnType hash) {
+        m_sent = input;
+        m_repeats = 0;
+        m_sentCheck = repeatCheck( hash );
+    }
+
+    /// Check the hash that follows the payload
+    bool checkHash(const uint8_t *payload, size_t size) {
+        HashReturnType hashFromInput;
+        memcpy( &hashFromInput, payload + size, sizeof( hashFromInput ) );
+        return m_hasher.calculate( payload, size ) == hashFromInput;
+    }
+
+    /// Hash of a tagged message, the tag is covered too: a flipped tag bit must not change the codec unnoticed
+    HashReturnType hashMessage(uint8_t tag, const void *payload, size_t size) {
+        m_hasher.init( );
+        m_hasher.update( &tag, sizeof( tag ) );
+        m_hasher.update( payload, size );
+        return m_hasher.finalize( );
+    }
+
+    /**
+     * @brief Hash of a delta message
+     * @details Covers the frame the delta decodes to, not only its bytes: a delta applied
+     *          to another reference than the sender's, e.g. after a lost one, fails the check.
+     */
+    HashReturnType hashDelta(uint8_t tag, const uint8_t *delta, size_t size, RawData const& frame) {
+        m_hasher.init( );
+        m_hasher.update( &tag, sizeof( tag ) );
+        m_hasher.update( delta, size );
+        m_hasher.update( frame.data( ), k_rawSize );
+        return m_hasher.finalize( );
+    }
+
+    /// Check the hash that follows the payload of a tagged message
+    bool checkMessage(uint8_t tag, const uint8_t *payload, size_t size) {
+        HashReturnType hashFromInput;
+        memcpy( &hashFromInput, payload + size, sizeof( hashFromInput ) );
+        return hashMessage( tag, payload, size ) == hashFromInput;
+    }
+
+    /**
+     * @brief Sends a changed frame by the smallest codec
+     * @details Delta is encoded first, it costs one pass and its reference must follow the input anyway;
+     *          if the stream rejects the message the reference goes back to the last frame sent.
+     *          Every k_keyframePeriod-th frame is absolute, so a lost delta does not spread forever.
+     */
+    template<typename T>
+    bool serializeAdaptive(RawData const& input, T *stream) {
+        uint8_t delta[ Delta::k_maxDeltaSize ];
+        const size_t deltaSize = m_delta.packDelta( input, delta );
+        detail_::PackedData buffer;
+        RawData clamped;
+        uint8_t tag;
+        Segment payload;
+        // Frame as the receiver decodes it
+        for ( size_t i = 0; i < clamped.size( ); ++i )
+            clamped[ i ] = PackingPolicy::denormalize( i, PackingPolicy::normalize( i, input[ i ] ) );
+        if ( m_sinceKeyframe + 1 < k_keyframePeriod && deltaSize < std::min( sizeof( detail_::PackedData ), k_rawSize ) ) {
+            tag = detail_::Tag::k_delta | static_cast< uint8_t >( deltaSize );
+            payload = { delta, deltaSize };
+        } else if constexpr ( k_rawSize < sizeof( detail_::PackedData ) ) {
+            tag = detail_::Tag::k_raw;
+            payload = { clamped.data( ), k_rawSize };
+        } else {
+            Packing::pack( input, &buffer );
+            tag = detail_::Tag::k_frame;
+            payload = { buffer.data( ), sizeof( buffer ) };
+        }
+        const HashReturnType hash = detail_::Tag::isDelta( tag )
+            ? hashDelta( tag, delta, deltaSize, clamped )
+            : hashMessage( tag, payload.data, payload.size );
+        LOG( "tag: %x, hash: %x\r\n", tag, hash );
+        if ( !Framing::template write< k_maxMessageSize >( stream, Segment{ &tag, sizeof( tag ) }, payload, Segment{ &hash, sizeof( hash ) } ) ) {
+            m_delta.reference( m_sent );
+            return false;
+        }
+        m_sinceKeyframe = detail_::Tag::isDelta( tag ) ?m_sinceKeyframe + 1 :0;
+        commitSent( input, hash );
+        return true;
+    }
+
+    /// Unpack one packed frame in place, without copying it out of the input
+    static void unpackFrame(const uint8_t *bytes, RawData *output) {
+        // View of packed data inside the input buffer
+        const detail_::PackedView buffer( bytes );
+//		Tool::Hex::dump( buffer.data( ), buffer.size( ), "packed" );
+        // Unpack data into output array
+        if constexpr ( detail_::Packing::detail_::HasView< Packing >::value ) {
+            Packing::unpack( buffer, output );
+        } else {
+            detail_::PackedData copy;
+            memcpy( copy.data( ), buffer.data( ), sizeof( copy ) );
+            Packing::unpack( copy, output );
+        }
+//		Tool::Hex::dump( output, "unpacked" );
+    }
+
+    /// Check hash and unpack one plain frame
+    bool deserializeFrame(const uint8_t *bytes, size_t size, RawData *output) {
+        // Check minimum packet size
+        if ( size < k_frameSize )
+            return false;
+        // Calculate hash for verification and compare with the one from input data
+        if ( !checkHash( bytes, sizeof( detail_::PackedData ) ) )
+            return false;
+        unpackFrame( bytes, output );
+        return true;
+    }
+
+    /// Check and decode one message of a tagged encoding
+    bool deserializeTagged(const uint8_t *bytes, size_t size, RawData *output) {
+        if ( !size )
+            return false;
+        const uint8_t tag = bytes[ 0 ];
+        if ( detail_::Tag::isRepeat( tag ) ) {
+            // Nothing to repeat yet, or the token repeats a message that did not arrive
+            if ( !m_hasReceived || ( tag & detail_::Tag::k_repeatCheck ) != m_receivedCheck )
+                return false;
+            *output = m_received;
+            return true;
+        }
+        if ( size < messageSize( tag, m_encoding ) )
+            return false;
+        const uint8_t *payload = bytes + 1;
+        if ( detail_::Tag::isDelta( tag ) ) {
+            const size_t length = detail_::Tag::deltaSize( tag );
+            RawData frame;
+            if ( m_delta.unpackDelta( payload, length, &frame ) != length )
+                return false;
+            HashReturnType hashFromInput;
+            memcpy( &hashFromInput, payload + length, sizeof( hashFromInput ) );
+            if ( hashDelta( tag, payload, length, frame ) != hashFromInput )
+                return false;
+            *output = frame;
+        } else if ( detail_::Tag::k_raw == tag ) {
+            if ( !checkMessage( tag, payload, k_rawSize ) )
+                return false;
+            memcpy( output ->data( ), payload, k_rawSize );
+            m_delta.synchronize( *output );
+        } else if ( detail_::Tag::k_frame == tag ) {
+            if ( !checkMessage( tag, payload, sizeof( detail_::PackedData ) ) )
+                return false;
+            unpackFrame( payload, output );
+            m_delta.synchronize( *output );
+        } else {
+            return false;
+        }
+        HashReturnType hash;
+        memcpy( &hash, bytes + messageSize( tag, m_encoding ) - k_hashSize, sizeof( hash ) );
+        m_received = *output;
+        m_hasReceived = true;
+        m_receivedCheck = repeatCheck( hash );
+        return true;
+    }
+
+    /// Message after the framing, nullptr if the framing found it malformed
+    bool deserializeMessage(const uint8_t *bytes, size_t size, RawData *output) {
+        if ( !bytes )
+            return false;
+        if ( Encoding::Plain == m_encoding )
+            return deserializeFrame( bytes, size, output );
+
+        if ( deserializeTagged( bytes, size, output ) )
+            return true;
+        // Whatever was lost, later repeat tokens and deltas must not build on it
+        m_hasReceived = false;
+        m_delta.desynchronize( );
+        return false;
+    }
+
+public:
+    /// Hash placement in a batch
+    enum class BatchHash {
+        /// Every frame is followed by its hash, same bytes as repeated serialize()
+        PerFrame,
+        /// One hash over all packed frames, after the last frame
+        Single
+    };
+
+    /**
+     * @brief Size of a batch in bytes
+     * @param count Number of frames
+     * @param mode Hash placement
+     */
+    static constexpr size_t batchSize(size_t count, BatchHash mode = BatchHash::Single) {
+        return ( BatchHash::PerFrame == mode )
+            ? count * k_frameSize
+            : count * sizeof( detail_::PackedData ) + k_hashSize;
+    }
+
+    /**
+     * @brief Size of a message by its first byte
+     * @details Lets a byte-stream reader know how much to collect before deserialize()
+     * @param tag First byte of the message, ignored for Encoding::Plain
+     * @param encoding Wire encoding
+     * @return Number of bytes of the whole message
+     */
+    static constexpr size_t messageSize(uint8_t tag, Encoding encoding) {
+        if ( Encoding::Plain == encoding )
+            return k_frameSize;
+        if ( detail_::Tag::isRepeat( tag ) )
+            return 1;
+        if ( detail_::Tag::isDelta( tag ) )
+            return 1 + detail_::Tag::deltaSize( tag ) + k_hashSize;
+        if ( detail_::Tag::k_raw == tag )
+            return 1 + k_rawSize + k_hashSize;
+        return 1 + k_frameSize;
+    }
+
+    /**
+     * @brief Hasher initialization
+     * @param encoding Wire encoding, must be the same on both sides
+     */
+    void begin(Encoding encoding = Encoding::Plain) {
         m_hasher.begin( );
+        m_encoding = encoding;
+        m_repeats = detail_::Tag::k_maxRepeats;
+        m_hasReceived = false;
+        m_delta = Delta{ };
+        m_sinceKeyframe = k_keyframePeriod;
     }
 
     /**
@@ -40,55 +329,134 @@ public:
      */
     template<typename T>
     bool serialize(RawData const& input, T *stream) {
+        if ( Encoding::Plain != m_encoding ) {
+            // Unchanged frame, neither packing nor hashing is needed
+            if ( m_repeats < detail_::Tag::k_maxRepeats && input == m_sent ) {
+                const uint8_t token = detail_::Tag::k_repeat | m_sentCheck;
+                if ( !Framing::template write< k_maxMessageSize >( stream, Segment{ &token, sizeof( token ) } ) )
+                    return false;
+                ++m_repeats;
+                return true;
+            }
+            // State follows only frames that reached the stream
+            if ( Encoding::Adaptive == m_encoding )
+                return serializeAdaptive( input, stream );
+        }
         // Buffer for packed data
         detail_::PackedData buffer;
         // Packing
         Packing::pack( input, &buffer );
-        // Size of packed data
-        const auto size = sizeof( buffer );
-        // Calculate hash for integrity check
-        const auto hash = m_hasher.calculate( buffer );
+        // Calculate hash for integrity check, of the tag too if there is one
+        const HashReturnType hash = ( Encoding::Plain == m_encoding )
+            ? m_hasher.calculate( buffer.data( ), sizeof( buffer ) )
+            : hashMessage( detail_::Tag::k_frame, buffer.data( ), sizeof( buffer ) );
 //		Tool::Hex::dump( input, "original" );
         Tool::Hex::dump( buffer, "packed" );
         LOG( "hash: %x\r\n", hash );
-        // Send to stream: packed data + hash
-        return true
-                && ( stream ->write( buffer.data( ), size ) == size )
-                && ( stream ->write( hash ) == sizeof( hash ) )
-            ;
+        // Send to stream: [tag] + packed data + hash
+        const Segment packed{ buffer.data( ), sizeof( buffer ) }, hashed{ &hash, sizeof( hash ) };
+        if ( Encoding::Plain == m_encoding )
+            return Framing::template write< k_maxMessageSize >( stream, packed, hashed );
+        if ( !Framing::template write< k_maxMessageSize >( stream, Segment{ &detail_::Tag::k_frame, sizeof( detail_::Tag::k_frame ) }, packed, hashed ) )
+            return false;
+        commitSent( input, hash );
+        return true;
     }
 
     /**
      * @brief Deserializes data from buffer
-     * @details Checks hash and unpacks data
-     * @param input Pointer to input buffer
+     * @details Checks hash and unpacks data, a repeat token expands to the last full frame.
+     *          In tagged encodings any message kind is accepted, the tag selects the codec;
+     *          the hash covers the tag, of a delta also the frame it decodes to. A repeat token carries
+     *          hash bits of the message it repeats. A rejected message or a token of a message not received
+     *          rejects repeat tokens until the next full frame and deltas until the next absolute one.
+     * @param input Pointer to input buffer, a framing that encodes (Framing::Cobs) decodes it in place
      * @param size Size of input buffer
      * @param output Pointer to output data array
      * @return true if data was deserialized successfully, false otherwise
      */
+    bool deserialize(void *input, size_t size, RawData *output) {
+        return deserializeMessage( Framing::unwrap( static_cast< uint8_t *>( input ), &size ), size, output );
+    }
+
+    /// Read-only input, for a framing that leaves the bytes as they are (Framing::Raw)
     bool deserialize(const void *input, size_t size, RawData *output) {
-        // Buffer for receiving packed data
-        detail_::PackedData buffer;
-        // Check minimum packet size
-        if ( size < sizeof( buffer ) + sizeof( HashReturnType ) )
+        return deserializeMessage( Framing::unwrap( static_cast< const uint8_t *>( input ), &size ), size, output );
+    }
+
+    /**
+     * @brief Checks the hash of a plain frame without unpacking it
+     * @details Cheap test of a candidate frame boundary, see Framing::Resync
+     * @param input Pointer to the frame
+     * @param size Size of input buffer
+     * @return true if the hash matches
+     */
+    bool verify(const void *input, size_t size) {
+        return size >= k_frameSize && checkHash( reinterpret_cast< const uint8_t *>( input ), sizeof( detail_::PackedData ) );
+    }
+
+    /**
+     * @brief Serializes many frames back-to-back into a caller buffer
+     * @details Packs all frames first and hashes them afterwards, no per-frame stream calls
+     * @param input Input frames
+     * @param count Number of frames
+     * @param output Output buffer
+     * @param capacity Size of the output buffer, at least batchSize(count, mode)
+     * @param mode Hash placement
+     * @return Number of bytes written, 0 if nothing to write or the buffer is too small
+     */
+    size_t serializeBatch(RawData const* input, size_t count, uint8_t *output, size_t capacity, BatchHash mode = BatchHash::Single) {
+        const size_t size = batchSize( count, mode );
+        if ( !count || capacity < size )
+            return 0;
+        if ( BatchHash::PerFrame == mode ) {
+            Batch::pack( input, count, output, k_frameSize );
+            for ( size_t i = 0; i < count; ++i ) {
+                uint8_t *frame = output + i * k_frameSize;
+                const HashReturnType hash = m_hasher.calculate( frame, sizeof( detail_::PackedData ) );
+                memcpy( frame + sizeof( detail_::PackedData ), &hash, sizeof( hash ) );
+            }
+        } else {
+            const size_t packed = count * sizeof( detail_::PackedData );
+            Batch::pack( input, count, output, sizeof( detail_::PackedData ) );
+            const HashReturnType hash = m_hasher.calculate( output, packed );
+            memcpy( output + packed, &hash, sizeof( hash ) );
+        }
+        return size;
+    }
+
+    /**
+     * @brief Deserializes many frames from a buffer produced by serializeBatch()
+     * @details Checks every hash first, unpacks only if all of them match
+     * @param input Pointer to input buffer
+     * @param size Size of input buffer
+     * @param output Pointer to output frames
+     * @param count Number of frames
+     * @param mode Hash placement
+     * @return true if all frames were deserialized, false otherwise
+     */
+    bool deserializeBatch(const void *input, size_t size, RawData *output, size_t count, BatchHash mode = BatchHash::Single) {
+        if ( !count || size < batchSize( count, mode ) )
             return false;
-        // Copy data from input buffer
-        memcpy( buffer.data( ), input, sizeof( buffer ) );
-//		Tool::Hex::dump( buffer, "packed" );
         const auto bytes = reinterpret_cast< const uint8_t *>( input );
-        // Extract hash from input data
-        const HashReturnType hashFromInput = bytes[ sizeof( buffer ) ];
-//		Serial.print( "hashFromInput: " ); Serial.println( hashFromInput, HEX );
-        // Calculate hash for verification
-        const HashReturnType hashCalculated = m_hasher.calculate( buffer );
-        LOG( "hashCalculated: %x\r\n", hashCalculated );
-        // Compare hashes
-        if ( hashCalculated != hashFromInput )
-            return false;
-        // Unpack data into output array
-        Packing::unpack( buffer, output );
-//		Tool::Hex::dump( output, "unpacked" );
+        size_t stride;
+        if ( BatchHash::PerFrame == mode ) {
+            stride = k_frameSize;
+            for ( size_t i = 0; i < count; ++i )
+                if ( !checkHash( bytes + i * k_frameSize, sizeof( detail_::PackedData ) ) )
+                    return false;
+        } else {
+            stride = sizeof( detail_::PackedData );
+            if ( !checkHash( bytes, count * sizeof( detail_::PackedData ) ) )
+                return false;
+        }
+        Batch::unpack( bytes, count, stride, output );
         return true;
     }
 };
-} //  namespace Serialization
\ No newline at end of file
+
+/// Serializer with the default packer, hasher and framing
+using Serializer = SerializerTpl< >;
+// Receiver (HardwareUART DMA buffer) expects exactly k_frameSize bytes
+static_assert( Serializer::k_frameSize == detail_::k_frameSize, "Sender and receiver frame sizes differ" );
+} //  namespace Serialization
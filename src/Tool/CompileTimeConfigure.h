@@ -19,14 +19,17 @@ static constexpr unsigned int countLeadingZeros(T x)
 }
 } // namespace detail_
 
-// Checks user configuration, ensures correct packing
-class CompileTimeConfigure {
+// Checks configuration, ensures correct packing
+// @tparam Type Array element type
+// @tparam Schema Tool::Schema with the range of every element
+template<typename Type, typename Schema>
+class CompileTimeConfigureTpl {
 public:
     // Capacity type used to calculate bit capacity
     using CapacityCompiler = size_t;
     // Input type
-    static_assert(std::is_unsigned<Config::type>::value, "Invalid type");
-    using InputType = Config::type;
+    static_assert(std::is_unsigned<Type>::value, "Invalid type");
+    using InputType = Type;
 
 private:
     // Maximum number of bits in CapacityCompiler type
@@ -35,66 +38,118 @@ private:
     // Output type is always fixed
     using OutputType = uint8_t;
 
-    // Check that minimal and maximum range are not swapped, etc.
-    static_assert(Config::maximum >= Config::minimal, "Invalid range: maximum < minimal");
-    static_assert(Config::maximum >= 0, "Maximum cannot be negative");
-    static_assert(Config::minimal >= 0, "Negative values are not supported");
-    static_assert(Config::amount > 0, "Amount must be positive");
+    // Number of elements
+    static constexpr size_t Amount = Schema::amount;
+    static_assert(Amount > 0, "Amount must be positive");
 
     // Check that the maximum value fits in CapacityCompiler type
-    static_assert(std::numeric_limits< decltype( Config::maximum ) >::digits <= maxPossibleBits, "Value exceeds capacity compiler");
-    // Convert maximum range to CapacityCompiler type
-    static constexpr auto rangeSize = static_cast< CapacityCompiler >( Config::maximum - Config::minimal );
-    // Number of leading zeros in the maximum value in CapacityCompiler
-    static constexpr auto leadingZerosBitsInMaximum = detail_::countLeadingZeros( rangeSize );
-    // Check for overflow after placing maximum value in CapacityCompiler
-    static_assert(leadingZerosBitsInMaximum <= maxPossibleBits, "Value exceeds capacity compiler");
-    // Number of bits to store the value
-    static constexpr OutputType bitCount = maxPossibleBits - leadingZerosBitsInMaximum;
+    static_assert(std::numeric_limits< unsigned int >::digits <= maxPossibleBits, "Value exceeds capacity compiler");
+
+    // Check that minimal and maximum range are not swapped in any element
+    static constexpr bool isRangeValid() {
+        for (size_t i = 0; i < Amount; ++i)
+            if (Schema::maximum[i] < Schema::minimal[i]) return false;
+        return true;
+    }
+    static_assert(isRangeValid(), "Invalid range: maximum < minimal");
+
+    // Number of bits to store the element
+    static constexpr OutputType bitCountOf(size_t field) {
+        // Convert range to CapacityCompiler type
+        const auto rangeSize = static_cast< CapacityCompiler >( Schema::maximum[field] - Schema::minimal[field] );
+        // Number of leading zeros in the range in CapacityCompiler
+        return maxPossibleBits - detail_::countLeadingZeros( rangeSize );
+    }
+    // Widest element
+    static constexpr OutputType maxBitCount() {
+        OutputType result = 0;
+        for (size_t i = 0; i < Amount; ++i)
+            if (bitCountOf(i) > result) result = bitCountOf(i);
+        return result;
+    }
+    static constexpr OutputType bitCount = maxBitCount();
+
+    // Number of bits of every element, table for run-time lookups
+    struct BitCounts {
+        OutputType value[Amount];
+    };
+    static constexpr BitCounts makeBitCounts() {
+        BitCounts result = { };
+        for (size_t i = 0; i < Amount; ++i)
+            result.value[i] = bitCountOf(i);
+        return result;
+    }
+    static constexpr BitCounts bitCounts = makeBitCounts();
 
     // Number of bits in the input type
     static constexpr auto maxBits = std::numeric_limits< InputType >::digits;
-    // Check that there is enough space to store the value
+    // Check that there is enough space to store every element
     static_assert(bitCount <= maxBits, "Input type too small");
+    static constexpr bool isMaximumFit() {
+        for (size_t i = 0; i < Amount; ++i)
+            if (Schema::maximum[i] > std::numeric_limits< InputType >::max()) return false;
+        return true;
+    }
+    static_assert(isMaximumFit(), "Input type too small");
 
-    // Clamp if exceeds maximum value
-    static constexpr InputType clamp(InputType value) {
-        const bool below_min = (value < Config::minimal);
-        const bool above_max = (value > Config::maximum);
-        if (below_min) return Config::minimal;
-        if (above_max) return Config::maximum;
+    // Clamp if exceeds the range of the element
+    static constexpr InputType clamp(size_t field, InputType value) {
+        const bool below_min = (value < Schema::minimal[field]);
+        const bool above_max = (value > Schema::maximum[field]);
+        if (below_min) return Schema::minimal[field];
+        if (above_max) return Schema::maximum[field];
         return value;
     }
     // Clear bits outside the stored value
-    static constexpr InputType applyMask(CapacityCompiler value) {
-        // The mask ensures only bitCount bits are processed
-        const InputType bitMask  = ( ( 1u << bitCount ) - 1 );
-        return value & bitMask;
+    static constexpr InputType applyMask(size_t field, CapacityCompiler value) {
+        // The mask ensures only bitCount bits of the element are processed
+        const CapacityCompiler bitMask = ( ( CapacityCompiler{ 1 } << bitCounts.value[field] ) - 1 );
+        return static_cast< InputType >( value & bitMask );
     }
 
 public:
     // Number of bytes in the array after packing
     static constexpr size_t packedSize() {
         // Number of bits in the output data
-        constexpr size_t total_bits = Config::amount * bitCount;
+        constexpr size_t total_bits = getBitOffset( Amount );
         // Round up to the nearest byte
         return ( total_bits + 7 ) / 8;
     }
     // Return the number of input data, just a getter
     static constexpr size_t getInputAmount() {
-        return Config::amount;
+        return Amount;
     }
-    // Return the number of bits in the output data, just a getter
+    // Return the number of bits of the widest element
     static constexpr size_t getOutputBitCount() {
         return bitCount;
     }
-    // Take into account the minimum value of the range
-    static constexpr InputType normalize(InputType value) {
+    // All elements have the same range
+    static constexpr bool isUniform() {
+        for (size_t i = 0; i < Amount; ++i)
+            if (Schema::minimal[i] != Schema::minimal[0] || Schema::maximum[i] != Schema::maximum[0]) return false;
+        return true;
+    }
+    // Return the number of bits of the element
+    static constexpr size_t getBitCount(size_t field) {
+        return bitCounts.value[field];
+    }
+    // Return the first bit of the element in the packed data, for Amount the total number of bits
+    static constexpr size_t getBitOffset(size_t field) {
+        size_t offset = 0;
+        for (size_t i = 0; i < field; ++i)
+            offset += bitCounts.value[i];
+        return offset;
+    }
+    // Take into account the minimum value of the element range
+    static constexpr InputType normalize(size_t field, InputType value) {
         // Normalize to [0, max-min]
-        return clamp( value ) - Config::minimal;
+        return clamp( field, value ) - Schema::minimal[field];
     }
-    static constexpr InputType denormalize(CapacityCompiler value) {
-        return applyMask( value ) + Config::minimal;
+    static constexpr InputType denormalize(size_t field, CapacityCompiler value) {
+        return applyMask( field, value ) + Schema::minimal[field];
     }
 };
+
+// User configuration from Config.h
+using CompileTimeConfigure = CompileTimeConfigureTpl< Config::type, Config::schema >;
 } // namespace Tool
\ No newline at end of file
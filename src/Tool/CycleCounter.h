@@ -0,0 +1,131 @@
+// src\Tool\CycleCounter.h - cycle counter for benchmarks, DWT on target and TSC on host
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstdint>
+#include <cstddef>
+#if defined( __arm__ )
+#include <libopencm3/cm3/dwt.h>
+#else
+#include <chrono>
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace Tool {
+namespace detail_ {
+#if defined( __arm__ )
+/// DWT CYCCNT of the Cortex-M3 core, wraps after ~59 s at 72 MHz
+struct DwtSource {
+    using Tick = uint32_t;
+    static constexpr const char *k_unit = "cycles";
+    static bool begin() {
+        return dwt_enable_cycle_counter( );
+    }
+    static Tick now() {
+        return dwt_read_cycle_counter( );
+    }
+};
+#else
+/// steady_clock in nanoseconds
+struct SteadySource {
+    using Tick = uint64_t;
+    static constexpr const char *k_unit = "ns";
+    static bool begin() {
+        return true;
+    }
+    static Tick now() {
+        using namespace std::chrono;
+        return duration_cast< nanoseconds >( steady_clock::now( ).time_since_epoch( ) ).count( );
+    }
+};
+#if defined( __x86_64__ ) || defined( __i386__ )
+/// Time stamp counter
+struct TscSource {
+    using Tick = uint64_t;
+    static constexpr const char *k_unit = "cycles";
+    static bool begin() {
+        return true;
+    }
+    static Tick now() {
+        return __rdtsc( );
+    }
+};
+#endif
+#endif
+} // namespace detail_
+
+/**
+ * @class CounterTpl
+ * @brief Free-running counter for measuring short code sections
+ * @tparam Source Backend: Tick type, k_unit, begin() and now()
+ */
+template<typename Source>
+class CounterTpl {
+public:
+    using Tick = typename Source::Tick;
+    static constexpr const char *k_unit = Source::k_unit;
+
+    /**
+     * @brief Start the counter
+     * @return false if the core has no cycle counter
+     */
+    static bool begin() {
+        return Source::begin( );
+    }
+
+    /// Current counter value
+    static Tick now() {
+        return Source::now( );
+    }
+
+    /**
+     * @brief Prevents the compiler from dropping the computation of the value
+     * @param value Pointer to the result to keep
+     */
+    static void keep(const void *value) {
+        __asm__ __volatile__( "" : : "r"( value ) : "memory" );
+    }
+
+    /**
+     * @brief Total number of ticks of all calls
+     * @param iterations Number of calls
+     * @param f Measured function
+     */
+    template<typename F>
+    static Tick elapsed(size_t iterations, F &&f) {
+        const Tick start = now( );
+        for ( size_t i = 0; i < iterations; ++i )
+            f( );
+        // Unsigned difference works on counter overflow
+        return static_cast< Tick >( now( ) - start );
+    }
+
+    /**
+     * @brief Average number of ticks per call
+     * @param iterations Number of calls
+     * @param f Measured function
+     * @return Ticks per call, rounded down
+     */
+    template<typename F>
+    static Tick measure(size_t iterations, F &&f) {
+        return elapsed( iterations, f ) / iterations;
+    }
+};
+
+#if defined( __arm__ )
+/// Core cycles on target
+using CycleCounter = CounterTpl< detail_::DwtSource >;
+/// Throughput counter: cycles on target
+using BenchCounter = CycleCounter;
+#else
+#if defined( __x86_64__ ) || defined( __i386__ )
+/// Time stamp counter cycles on x86 hosts
+using CycleCounter = CounterTpl< detail_::TscSource >;
+#else
+/// Nanoseconds on other hosts
+using CycleCounter = CounterTpl< detail_::SteadySource >;
+#endif
+/// Throughput counter: nanoseconds on host, comparable between machines
+using BenchCounter = CounterTpl< detail_::SteadySource >;
+#endif
+} // namespace Tool
@@ -0,0 +1,49 @@
+// src\Tool\Schema.h - compile-time list of channels with individual ranges
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <utility>
+
+namespace Tool {
+/**
+ * @brief One channel of the schema
+ * @tparam Minimal Minimum value of the channel (inclusive)
+ * @tparam Maximum Maximum value of the channel (inclusive)
+ */
+template<unsigned int Minimal, unsigned int Maximum>
+struct Field {
+    static constexpr unsigned int minimal = Minimal;
+    static constexpr unsigned int maximum = Maximum;
+};
+
+/**
+ * @brief List of channels, each packed with the bits of its own range
+ * @details Validated by CompileTimeConfigure, the packers read the ranges at compile time.
+ * @tparam Fields Field<> per element, in order
+ */
+template<typename... Fields>
+struct Schema {
+    static_assert( sizeof...( Fields ) > 0, "Amount must be positive" );
+    /// Number of elements
+    static constexpr size_t amount = sizeof...( Fields );
+    /// Minimum value per element
+    static constexpr unsigned int minimal[] = { Fields::minimal... };
+    /// Maximum value per element
+    static constexpr unsigned int maximum[] = { Fields::maximum... };
+};
+
+namespace detail_ {
+template<size_t, typename T>
+using Same = T;
+
+template<typename F, typename Sequence>
+struct Uniform;
+template<typename F, size_t... I>
+struct Uniform< F, std::index_sequence< I... > > {
+    using type = Schema< Same< I, F >... >;
+};
+} // namespace detail_
+
+/// Schema of Amount elements with the same range
+template<unsigned int Amount, unsigned int Minimal, unsigned int Maximum>
+using UniformSchema = typename detail_::Uniform< Field< Minimal, Maximum >, std::make_index_sequence< Amount > >::type;
+} // namespace Tool
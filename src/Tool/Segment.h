@@ -0,0 +1,11 @@
+// src\Tool\Segment.h - piece of a message for vectored writes
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+
+namespace Tool {
+/// Bytes in place, e.g. header, payload and hash of one message sent without gathering them first
+struct Segment {
+    const void *data;
+    size_t size;
+};
+} // namespace Tool
@@ -0,0 +1,48 @@
+// src\Tool\Span.h - non-owning view of a fixed number of elements
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace Tool {
+/**
+ * @class Span
+ * @brief Pointer with a compile-time length, in place of std::span missing in C++17
+ * @details Lets readers work on bytes where they already are (DMA buffer, caller buffer)
+ *          instead of copying them into a std::array first.
+ * @tparam T Element type, const for a read-only view
+ * @tparam N Number of elements
+ */
+template<typename T, size_t N>
+class Span {
+    T *m_data;
+
+public:
+    using value_type = std::remove_cv_t< T >;
+
+    /// View of N elements starting at data
+    explicit constexpr Span(T *data) : m_data( data ) {}
+
+    /// View of a whole array of the same length
+    template<typename U, typename = std::enable_if_t< std::is_convertible_v< U(*)[], T(*)[] > > >
+    constexpr Span(std::array< U, N > &array) : m_data( array.data( ) ) {}
+    template<typename U, typename = std::enable_if_t< std::is_convertible_v< const U(*)[], T(*)[] > > >
+    constexpr Span(std::array< U, N > const& array) : m_data( array.data( ) ) {}
+
+    constexpr T *data() const {
+        return m_data;
+    }
+    static constexpr size_t size() {
+        return N;
+    }
+    constexpr T &operator[](size_t i) const {
+        return m_data[ i ];
+    }
+    constexpr T *begin() const {
+        return m_data;
+    }
+    constexpr T *end() const {
+        return m_data + N;
+    }
+};
+} // namespace Tool
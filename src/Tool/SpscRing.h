@@ -0,0 +1,188 @@
+// src\Tool\SpscRing.h - wait-free single-producer single-consumer ring buffer
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <atomic>
+#include <cstddef>
+#include "Tool/Segment.h"
+
+namespace Tool {
+/**
+ * @class SpscRing
+ * @brief Ring buffer between one producer and one consumer without locks or masked interrupts
+ * @details Typical sides: an interrupt handler and the main loop, or two threads on host.
+ *          Indices run freely and wrap by the mask. Each index is written by its own side only:
+ *          head by the producer, tail by the consumer. The writer publishes with release,
+ *          the other side reads with acquire, so elements are complete before they become visible
+ *          (on Cortex-M3 this is a dmb, interrupts stay enabled).
+ *          Every operation is wait-free.
+ * @tparam T Element type, trivially copyable
+ * @tparam N Capacity, power of two
+ */
+template<typename T, size_t N>
+class SpscRing {
+    static_assert( N && 0 == ( N & ( N - 1 ) ), "Capacity must be a power of two" );
+    static_assert( std::atomic< size_t >::is_always_lock_free, "Indices must be lock-free" );
+    static constexpr size_t k_mask = N - 1;
+
+    T m_data[ N ] = { };
+    std::atomic< size_t > m_head{ 0 };
+    std::atomic< size_t > m_tail{ 0 };
+
+public:
+    static constexpr size_t k_capacity = N;
+
+    /// Both sides to empty, only while neither works
+    void reset() {
+        m_head.store( 0, std::memory_order_relaxed );
+        m_tail.store( 0, std::memory_order_relaxed );
+    }
+
+    /// Elements published so far, the index of the next element to write
+    size_t head() const {
+        return m_head.load( std::memory_order_acquire );
+    }
+    /// Elements taken so far, the index of the next element to read
+    size_t tail() const {
+        return m_tail.load( std::memory_order_acquire );
+    }
+
+    // Producer side
+
+    /// Room for elements
+    size_t free() const {
+        return N - ( m_head.load( std::memory_order_relaxed ) - m_tail.load( std::memory_order_acquire ) );
+    }
+
+    /**
+     * @brief Add one element
+     * @return false if full
+     */
+    bool push(T const& value) {
+        const size_t head = m_head.load( std::memory_order_relaxed );
+        if ( head - m_tail.load( std::memory_order_acquire ) == N )
+            return false;
+        m_data[ head & k_mask ] = value;
+        m_head.store( head + 1, std::memory_order_release );
+        return true;
+    }
+
+    /**
+     * @brief Add elements, all or nothing
+     * @return false if there is no room for all of them
+     */
+    bool write(const T *data, size_t count) {
+        const size_t head = m_head.load( std::memory_order_relaxed );
+        if ( count > N - ( head - m_tail.load( std::memory_order_acquire ) ) )
+            return false;
+        for ( size_t i = 0; i < count; ++i )
+            m_data[ ( head + i ) & k_mask ] = data[ i ];
+        m_head.store( head + count, std::memory_order_release );
+        return true;
+    }
+
+    /**
+     * @brief Add the bytes of several segments, published together, all or nothing
+     * @details The consumer sees the segments as one contiguous run, never a part of them.
+     * @return false if there is no room for all of them
+     */
+    bool writev(const Segment *segments, size_t count) {
+        static_assert( sizeof( T ) == 1, "Segments are in bytes" );
+        size_t total = 0;
+        for ( size_t i = 0; i < count; ++i )
+            total += segments[ i ].size;
+        size_t head = m_head.load( std::memory_order_relaxed );
+        if ( total > N - ( head - m_tail.load( std::memory_order_acquire ) ) )
+            return false;
+        for ( size_t i = 0; i < count; ++i ) {
+            const T *data = static_cast< const T *>( segments[ i ].data );
+            for ( size_t j = 0; j < segments[ i ].size; ++j )
+                m_data[ head++ & k_mask ] = data[ j ];
+        }
+        m_head.store( head, std::memory_order_release );
+        return true;
+    }
+
+    /// Storage for a hardware producer, e.g. circular DMA over the whole ring
+    T *data() {
+        return m_data;
+    }
+
+    /**
+     * @brief Publish elements already written into data() after head
+     * @details A hardware producer does not wait for room: if it laps the consumer,
+     *          size() exceeds the capacity and the consumer has to drop().
+     */
+    void commit(size_t count) {
+        m_head.store( m_head.load( std::memory_order_relaxed ) + count, std::memory_order_release );
+    }
+
+    // Consumer side
+
+    /// Published elements not yet taken, above the capacity after an overrun by commit()
+    size_t size() const {
+        return m_head.load( std::memory_order_acquire ) - m_tail.load( std::memory_order_relaxed );
+    }
+    bool empty() const {
+        return !size( );
+    }
+
+    /**
+     * @brief Take one element
+     * @return false if empty
+     */
+    bool pop(T *value) {
+        const size_t tail = m_tail.load( std::memory_order_relaxed );
+        if ( m_head.load( std::memory_order_acquire ) == tail )
+            return false;
+        *value = m_data[ tail & k_mask ];
+        m_tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    /**
+     * @brief Copy up to count elements without taking them
+     * @return Number of copied elements
+     */
+    size_t peek(T *data, size_t count) const {
+        const size_t tail = m_tail.load( std::memory_order_relaxed );
+        const size_t available = m_head.load( std::memory_order_acquire ) - tail;
+        if ( count > available )
+            count = available;
+        for ( size_t i = 0; i < count; ++i )
+            data[ i ] = m_data[ ( tail + i ) & k_mask ];
+        return count;
+    }
+
+    /**
+     * @brief Take up to count elements
+     * @return Number of taken elements
+     */
+    size_t read(T *data, size_t count) {
+        count = peek( data, count );
+        release( count );
+        return count;
+    }
+
+    /**
+     * @brief Elements available in place up to the end of the storage, e.g. for DMA
+     * @param[out] data Pointer to the first one
+     * @return Number of contiguous elements
+     */
+    size_t readable(const T **data) const {
+        const size_t tail = m_tail.load( std::memory_order_relaxed );
+        const size_t offset = tail & k_mask;
+        const size_t available = m_head.load( std::memory_order_acquire ) - tail;
+        *data = m_data + offset;
+        return ( available < N - offset ) ?available :N - offset;
+    }
+
+    /// Give back the slots of elements read in place or peeked
+    void release(size_t count) {
+        m_tail.store( m_tail.load( std::memory_order_relaxed ) + count, std::memory_order_release );
+    }
+
+    /// Skip everything published
+    void drop() {
+        m_tail.store( m_head.load( std::memory_order_acquire ), std::memory_order_release );
+    }
+};
+} // namespace Tool
@@ -0,0 +1,72 @@
+// src\Tool\Varint.h - zigzag and varint (LEB128) coding
+#pragma once // Copyright 2025 Alex0vSky (https://github.com/Alex0vSky)
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Tool {
+/**
+ * @class Varint
+ * @brief Variable-length coding of unsigned integers, 7 bits per byte, LSB group first
+ * @details Values 0-127 take one byte. Signed values are mapped by zigzag first,
+ *          so small differences of either sign stay short.
+ */
+class Varint {
+public:
+    /// Maximum encoded size of the type in bytes
+    template<typename T>
+    static constexpr size_t maxSize() {
+        return ( std::numeric_limits< std::make_unsigned_t< T > >::digits + 6 ) / 7;
+    }
+
+    /// Map signed to unsigned: 0, -1, 1, -2, 2 ... -> 0, 1, 2, 3, 4 ...
+    static constexpr uint32_t zigzag(int32_t value) {
+        return ( static_cast< uint32_t >( value ) << 1 ) ^ static_cast< uint32_t >( value >> 31 );
+    }
+
+    /// Reverse of zigzag()
+    static constexpr int32_t unzigzag(uint32_t value) {
+        return static_cast< int32_t >( value >> 1 ) ^ -static_cast< int32_t >( value & 1 );
+    }
+
+    /**
+     * @brief Encode the value
+     * @param value Unsigned value
+     * @param output Output buffer, at least maxSize<T>() bytes
+     * @return Number of bytes written
+     */
+    template<typename T>
+    static size_t encode(T value, uint8_t *output) {
+        static_assert( std::is_unsigned< T >::value, "Only unsigned, use zigzag()" );
+        size_t size = 0;
+        while ( value >= 0x80 ) {
+            output[ size++ ] = static_cast< uint8_t >( value | 0x80 );
+            value >>= 7;
+        }
+        output[ size++ ] = static_cast< uint8_t >( value );
+        return size;
+    }
+
+    /**
+     * @brief Decode the value
+     * @param input Input buffer
+     * @param size Size of input buffer
+     * @param value Pointer to decoded value
+     * @return Number of bytes read, 0 if truncated or too long for the type
+     */
+    template<typename T>
+    static size_t decode(const uint8_t *input, size_t size, T *value) {
+        static_assert( std::is_unsigned< T >::value, "Only unsigned, use unzigzag()" );
+        T result = 0;
+        for ( size_t i = 0; i < size && i < maxSize< T >( ); ++i ) {
+            result |= static_cast< T >( input[ i ] & 0x7F ) << ( 7 * i );
+            if ( !( input[ i ] & 0x80 ) ) {
+                *value = result;
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+};
+} // namespace Tool
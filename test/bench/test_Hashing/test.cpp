@@ -0,0 +1,100 @@
+// test/bench/test_Hashing/test.cpp - throughput of the hashers over payload sizes, runs on host and target
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include <cstdio>
+#include <cstdlib>
+#include "Serialization/Hash/CrcSoftware.h"
+#include "Serialization/Hash/SumSoftware.h"
+#if defined( __arm__ )
+#include "Serialization/Hash/CrcHardware.h"
+#endif
+#include "Tool/CycleCounter.h"
+
+/*
+ * Every measurement is one machine-readable line of the test output:
+ *   bench,<hasher>,<payload bytes>,<unit>/byte,<value>
+ * e.g. `pio test -e native -f bench/test_Hashing | grep bench, | cut -d, -f2-`
+ * Host reports nanoseconds, target reports core cycles.
+ */
+
+using Counter = Tool::BenchCounter;
+using namespace Serialization::detail_::Hash;
+// From one packed frame up to a large batch
+constexpr size_t k_sizes[] = { 5, 16, 64, 256, 1024, 4096 };
+// Bytes hashed per point, iterations are scaled by payload size
+constexpr size_t k_bytesPerPoint = 64 * 1024;
+// Fixed-point scale of the reported value, three decimals
+constexpr unsigned long k_scale = 1000;
+
+static uint8_t g_data[4096];
+
+// Ticks per byte multiplied by k_scale
+template<typename THasher>
+unsigned long measure(const char *name, size_t size) {
+    THasher hasher;
+    hasher.begin();
+    const size_t iterations = k_bytesPerPoint / size;
+    const auto ticks = Counter::elapsed(iterations, [&] {
+            auto hash = hasher.calculate(g_data, size);
+            Counter::keep(&hash);
+        });
+    const unsigned long perByte = static_cast<unsigned long>(static_cast<uint64_t>(ticks) * k_scale / (iterations * size));
+
+    char message[96];
+    snprintf(message, sizeof(message), "bench,%s,%lu,%s/byte,%lu.%03lu"
+        , name, static_cast<unsigned long>(size), Counter::k_unit, perByte / k_scale, perByte % k_scale);
+    TEST_MESSAGE(message);
+    return perByte;
+}
+
+template<typename THasher>
+void sweep(const char *name) {
+    for (auto &value : g_data)
+        value = rand();
+    Counter::begin();
+    for (size_t size : k_sizes)
+        measure<THasher>(name, size);
+}
+
+void test_bench_CrcSoftware_Bitwise() {
+    sweep<CrcSoftwareTpl<CrcMethod::Bitwise>>("crc8-bitwise");
+}
+
+void test_bench_CrcSoftware_Table() {
+    sweep<CrcSoftwareTpl<CrcMethod::Table>>("crc8-table");
+}
+
+void test_bench_CrcSoftware_Slicing4() {
+    sweep<CrcSoftwareTpl<CrcMethod::Slicing4>>("crc8-slicing4");
+}
+
+void test_bench_Crc16Software() {
+    sweep<CrcSoftwareTpl<CrcMethod::Table, Crc::Ccitt16>>("crc16-table");
+    sweep<CrcSoftwareTpl<CrcMethod::Slicing4, Crc::Ccitt16>>("crc16-slicing4");
+}
+
+void test_bench_Crc32Software() {
+    sweep<CrcSoftwareTpl<CrcMethod::Table, Crc::Crc32>>("crc32-table");
+    sweep<CrcSoftwareTpl<CrcMethod::Slicing4, Crc::Crc32>>("crc32-slicing4");
+}
+
+void test_bench_SumSoftware() {
+    sweep<SumSoftware>("sum");
+}
+
+void test_bench_CrcHardware() {
+#if defined( __arm__ )
+    sweep<CrcHardware>("crc32-hardware");
+#else
+    TEST_IGNORE_MESSAGE("CRC peripheral on target only");
+#endif
+}
+
+// Regression guard, on a large payload where the per-call overhead does not matter
+void test_table_faster_than_bitwise() {
+    Counter::begin();
+    const auto bitwise = measure<CrcSoftwareTpl<CrcMethod::Bitwise>>("crc8-bitwise", 1024);
+    const auto table = measure<CrcSoftwareTpl<CrcMethod::Table>>("crc8-table", 1024);
+    TEST_ASSERT_LESS_THAN(bitwise, table);
+}
@@ -0,0 +1,94 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Serialization/Hash/CrcSoftware.h"
+#include "Serialization/Hash/SumSoftware.h"
+#if defined( __arm__ )
+#include "Serialization/Hash/CrcHardware.h"
+#endif
+#include "Tool/CycleCounter.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_bench_CrcSoftware_Bitwise();
+extern void test_bench_CrcSoftware_Table();
+extern void test_bench_CrcSoftware_Slicing4();
+extern void test_bench_Crc16Software();
+extern void test_bench_Crc32Software();
+extern void test_bench_SumSoftware();
+extern void test_bench_CrcHardware();
+extern void test_table_faster_than_bitwise();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/bench/test_Hashing/test.cpp");
+  run_test(test_bench_CrcSoftware_Bitwise, "test_bench_CrcSoftware_Bitwise", 60);
+  run_test(test_bench_CrcSoftware_Table, "test_bench_CrcSoftware_Table", 64);
+  run_test(test_bench_CrcSoftware_Slicing4, "test_bench_CrcSoftware_Slicing4", 68);
+  run_test(test_bench_Crc16Software, "test_bench_Crc16Software", 72);
+  run_test(test_bench_Crc32Software, "test_bench_Crc32Software", 77);
+  run_test(test_bench_SumSoftware, "test_bench_SumSoftware", 82);
+  run_test(test_bench_CrcHardware, "test_bench_CrcHardware", 86);
+  run_test(test_table_faster_than_bitwise, "test_table_faster_than_bitwise", 95);
+
+  return UnityEnd();
+}
@@ -0,0 +1,93 @@
+// test/bench/test_Packing/test.cpp - cycles per frame of the packers, runs on host and target
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include <cstdio>
+#include <cstdlib>
+#include "Serialization/Packing/Ordinary.h"
+#include "Serialization/Packing/viaBitReader.h"
+#include "Serialization/Packing/viaAccumulator.h"
+#include "Serialization/Packing/Unrolled.h"
+#include "Tool/CycleCounter.h"
+
+using Counter = Tool::CycleCounter;
+// Number of frames to average
+constexpr size_t k_iterations = 4096;
+// Several different frames, so the compiler cannot fold the input
+constexpr size_t k_frames = 16;
+
+struct Result {
+    Counter::Tick pack;
+    Counter::Tick unpack;
+};
+
+void fill(Serialization::RawData (&frames)[k_frames]) {
+    for (auto &frame : frames)
+        for (size_t i = 0; i < frame.size(); ++i)
+            frame[i] = Config::schema::minimal[i] + rand() % (Config::schema::maximum[i] - Config::schema::minimal[i] + 1);
+}
+
+template<typename TPacker>
+Result measure(const char *name) {
+    Serialization::RawData frames[k_frames];
+    fill(frames);
+    Serialization::detail_::PackedData packed[k_frames];
+    Serialization::RawData unpacked;
+    Counter::begin();
+
+    size_t i = 0;
+    Result result;
+    result.pack = Counter::measure(k_iterations, [&] {
+            const size_t n = i++ % k_frames;
+            TPacker::pack(frames[n], &packed[n]);
+            Counter::keep(&packed[n]);
+        });
+    i = 0;
+    result.unpack = Counter::measure(k_iterations, [&] {
+            TPacker::unpack(packed[i++ % k_frames], &unpacked);
+            Counter::keep(&unpacked);
+        });
+
+    char message[96];
+    snprintf(message, sizeof(message), "%s: pack %lu, unpack %lu %s/frame"
+        , name, static_cast<unsigned long>(result.pack), static_cast<unsigned long>(result.unpack), Counter::k_unit);
+    TEST_MESSAGE(message);
+    return result;
+}
+
+void test_bench_viaBitReader() {
+    measure<Serialization::detail_::Packing::viaBitReader>("viaBitReader");
+}
+
+void test_bench_Ordinary() {
+    measure<Serialization::detail_::Packing::Ordinary>("Ordinary");
+}
+
+void test_bench_viaAccumulator() {
+    measure<Serialization::detail_::Packing::viaAccumulator>("viaAccumulator");
+}
+
+void test_bench_Unrolled() {
+    measure<Serialization::detail_::Packing::Unrolled>("Unrolled");
+}
+
+void test_accumulator_faster_than_bitreader() {
+    const auto bitReader = measure<Serialization::detail_::Packing::viaBitReader>("viaBitReader");
+    const auto accumulator = measure<Serialization::detail_::Packing::viaAccumulator>("viaAccumulator");
+    TEST_ASSERT_LESS_THAN(bitReader.pack, accumulator.pack);
+    TEST_ASSERT_LESS_THAN(bitReader.unpack, accumulator.unpack);
+}
+
+void test_accumulator_same_layout() {
+    Serialization::RawData frames[k_frames];
+    fill(frames);
+    for (auto const& frame : frames) {
+        Serialization::detail_::PackedData expected, actual;
+        Serialization::RawData unpacked;
+        Serialization::detail_::Packing::viaBitReader::pack(frame, &expected);
+        Serialization::detail_::Packing::viaAccumulator::pack(frame, &actual);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), actual.data(), sizeof(actual));
+        Serialization::detail_::Packing::viaAccumulator::unpack(actual, &unpacked);
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(frame.data(), unpacked.data(), frame.size());
+    }
+}
@@ -0,0 +1,89 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Serialization/Packing/Ordinary.h"
+#include "Serialization/Packing/viaBitReader.h"
+#include "Serialization/Packing/viaAccumulator.h"
+#include "Serialization/Packing/Unrolled.h"
+#include "Tool/CycleCounter.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_bench_viaBitReader();
+extern void test_bench_Ordinary();
+extern void test_bench_viaAccumulator();
+extern void test_bench_Unrolled();
+extern void test_accumulator_faster_than_bitreader();
+extern void test_accumulator_same_layout();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/bench/test_Packing/test.cpp");
+  run_test(test_bench_viaBitReader, "test_bench_viaBitReader", 58);
+  run_test(test_bench_Ordinary, "test_bench_Ordinary", 62);
+  run_test(test_bench_viaAccumulator, "test_bench_viaAccumulator", 66);
+  run_test(test_bench_Unrolled, "test_bench_Unrolled", 70);
+  run_test(test_accumulator_faster_than_bitreader, "test_accumulator_faster_than_bitreader", 74);
+  run_test(test_accumulator_same_layout, "test_accumulator_same_layout", 81);
+
+  return UnityEnd();
+}
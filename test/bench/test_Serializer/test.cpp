@@ -0,0 +1,90 @@
+// test/bench/test_Serializer/test.cpp - cycles per frame of every packer/hasher combination, runs on host and target
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include <cstdio>
+#include <cstdlib>
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/Hash/SumSoftware.h"
+#include "Serialization/Packing/viaAccumulator.h"
+#include "Serialization/Packing/Unrolled.h"
+#include "Tool/CycleCounter.h"
+
+using Counter = Tool::CycleCounter;
+// Number of frames to average
+constexpr size_t k_iterations = 4096;
+// Several different frames, so the compiler cannot fold the input
+constexpr size_t k_frames = 16;
+
+// Stream writing into a memory buffer, rewound before each frame
+struct Sink {
+    uint8_t data[64];
+    size_t size = 0;
+    size_t write(const uint8_t *buffer, size_t length) {
+        memcpy(data + size, buffer, length);
+        size += length;
+        return length;
+    }
+};
+
+template<typename TPacker, typename THasher>
+void measure(const char *name) {
+    using Serializer = Serialization::SerializerTpl<TPacker, THasher>;
+    Serializer serializer;
+    serializer.begin();
+    Serialization::RawData frames[k_frames];
+    for (auto &frame : frames)
+        for (size_t i = 0; i < frame.size(); ++i)
+            frame[i] = Config::schema::minimal[i] + rand() % (Config::schema::maximum[i] - Config::schema::minimal[i] + 1);
+    Sink sinks[k_frames];
+    Serialization::RawData output;
+    Counter::begin();
+
+    size_t i = 0;
+    const auto serialize = Counter::measure(k_iterations, [&] {
+            const size_t n = i++ % k_frames;
+            sinks[n].size = 0;
+            serializer.serialize(frames[n], &sinks[n]);
+            Counter::keep(&sinks[n]);
+        });
+    i = 0;
+    bool ok = true;
+    const auto deserialize = Counter::measure(k_iterations, [&] {
+            const size_t n = i++ % k_frames;
+            ok &= serializer.deserialize(sinks[n].data, sinks[n].size, &output);
+            Counter::keep(&output);
+        });
+    TEST_ASSERT_TRUE(ok);
+
+    char message[96];
+    snprintf(message, sizeof(message), "%s: serialize %lu, deserialize %lu %s/frame"
+        , name, static_cast<unsigned long>(serialize), static_cast<unsigned long>(deserialize), Counter::k_unit);
+    TEST_MESSAGE(message);
+}
+
+using namespace Serialization::detail_;
+
+void test_bench_viaBitReader_CrcSoftware() {
+    measure<Packing::viaBitReader, Hash::CrcSoftware>("viaBitReader + CrcSoftware");
+}
+
+void test_bench_viaBitReader_SumSoftware() {
+    measure<Packing::viaBitReader, Hash::SumSoftware>("viaBitReader + SumSoftware");
+}
+
+void test_bench_viaAccumulator_CrcSoftware() {
+    measure<Packing::viaAccumulator, Hash::CrcSoftware>("viaAccumulator + CrcSoftware");
+}
+
+void test_bench_viaAccumulator_SumSoftware() {
+    measure<Packing::viaAccumulator, Hash::SumSoftware>("viaAccumulator + SumSoftware");
+}
+
+void test_bench_Unrolled_CrcSoftware() {
+    measure<Packing::Unrolled, Hash::CrcSoftware>("Unrolled + CrcSoftware");
+}
+
+void test_bench_Unrolled_SumSoftware() {
+    measure<Packing::Unrolled, Hash::SumSoftware>("Unrolled + SumSoftware");
+}
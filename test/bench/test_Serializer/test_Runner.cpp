@@ -0,0 +1,90 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+#include "Serialization/Hash/SumSoftware.h"
+#include "Serialization/Packing/viaAccumulator.h"
+#include "Serialization/Packing/Unrolled.h"
+#include "Tool/CycleCounter.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_bench_viaBitReader_CrcSoftware();
+extern void test_bench_viaBitReader_SumSoftware();
+extern void test_bench_viaAccumulator_CrcSoftware();
+extern void test_bench_viaAccumulator_SumSoftware();
+extern void test_bench_Unrolled_CrcSoftware();
+extern void test_bench_Unrolled_SumSoftware();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/bench/test_Serializer/test.cpp");
+  run_test(test_bench_viaBitReader_CrcSoftware, "test_bench_viaBitReader_CrcSoftware", 68);
+  run_test(test_bench_viaBitReader_SumSoftware, "test_bench_viaBitReader_SumSoftware", 72);
+  run_test(test_bench_viaAccumulator_CrcSoftware, "test_bench_viaAccumulator_CrcSoftware", 76);
+  run_test(test_bench_viaAccumulator_SumSoftware, "test_bench_viaAccumulator_SumSoftware", 80);
+  run_test(test_bench_Unrolled_CrcSoftware, "test_bench_Unrolled_CrcSoftware", 84);
+  run_test(test_bench_Unrolled_SumSoftware, "test_bench_Unrolled_SumSoftware", 88);
+
+  return UnityEnd();
+}
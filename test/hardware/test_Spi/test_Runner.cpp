@@ -2,9 +2,9 @@
 
 /*=======Automagically Detected Files To Include=====*/
 #include "unity.h"
-#include "Device/SysTick.h"
 #include "Logger.h"
-#include "Node/HighSpeedLink.h"
+#include "Device/SpiDma.h"
+#include "Tool/CycleCounter.h"
 
 /*=======External Functions This Runner Calls=====*/
 extern void setUp(void);
@@ -71,7 +71,7 @@ static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE l
 int main(void)
 {
   UnityBegin("test/hardware/test_Spi/test.cpp");
-  run_test(test_spi_loopback, "test_spi_loopback", 18);
+  run_test(test_spi_loopback, "test_spi_loopback", 9);
 
   return UnityEnd();
 }
@@ -4,6 +4,17 @@ void setUp() {} void tearDown() {}
 
 #include "Device/HardwareUART.h"
 
+// Sources are not built with the tests, vectors as in HardwareUART.cpp
+extern "C" void dma1_channel3_isr(void) {
+    Device::HardwareUART::rxIsr( );
+}
+extern "C" void dma1_channel2_isr(void) {
+    Device::HardwareUART::txIsr( );
+}
+extern "C" void usart3_isr(void) {
+    Device::HardwareUART::usartIsr( );
+}
+
 void test_uart_loopback(void) {
 	Device::HardwareUART uart;
 	uart.begin( 9600 );
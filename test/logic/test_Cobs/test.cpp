@@ -0,0 +1,194 @@
+// test\logic\test_Cobs\test.cpp - self-synchronizing framing of the stream
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+
+using Cobs = Serialization::detail_::Framing::Cobs;
+using Segment = Serialization::detail_::Framing::Segment;
+using Framed = Serialization::SerializerTpl<Serialization::detail_::Packing::viaBitReader, Serialization::detail_::Hasher, Cobs>;
+
+// Stream collecting everything written
+struct Sink {
+    uint8_t data[1024];
+    size_t size = 0;
+    size_t writes = 0;
+    size_t write(const uint8_t *buffer, size_t length) {
+        memcpy(data + size, buffer, length);
+        size += length;
+        ++writes;
+        return length;
+    }
+};
+
+static void roundtrip(const uint8_t *message, size_t size, const uint8_t *expected, size_t expectedSize) {
+    Sink sink;
+    TEST_ASSERT_TRUE(Cobs::write<300>(&sink, Segment{message, size}));
+    TEST_ASSERT_EQUAL(expectedSize, sink.size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, sink.data, expectedSize);
+    TEST_ASSERT_LESS_OR_EQUAL(Cobs::maxSize(size), sink.size);
+    size_t length = sink.size;
+    TEST_ASSERT_EQUAL_PTR(sink.data, Cobs::unwrap(sink.data, &length));
+    TEST_ASSERT_EQUAL(size, length);
+    if (size)
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(message, sink.data, size);
+}
+
+void test_known_encodings() {
+    const uint8_t zero[] = {0x00}, zeroEncoded[] = {0x01, 0x01, 0x00};
+    roundtrip(zero, sizeof(zero), zeroEncoded, sizeof(zeroEncoded));
+    const uint8_t mixed[] = {0x11, 0x22, 0x00, 0x33}, mixedEncoded[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+    roundtrip(mixed, sizeof(mixed), mixedEncoded, sizeof(mixedEncoded));
+    const uint8_t empty[] = {0x01, 0x00};
+    roundtrip(nullptr, 0, empty, sizeof(empty));
+}
+
+void test_long_runs() {
+    uint8_t message[300], expected[310];
+    for (size_t i = 0; i < sizeof(message); ++i)
+        message[i] = static_cast<uint8_t>(i % 255 + 1);
+    // 254 non-zero bytes fill a block without an implied zero
+    expected[0] = 0xFF;
+    memcpy(expected + 1, message, 254);
+    expected[255] = 0x01;
+    expected[256] = 0x00;
+    roundtrip(message, 254, expected, 257);
+    expected[255] = 300 - 254 + 1;
+    memcpy(expected + 256, message + 254, 300 - 254);
+    expected[302] = 0x00;
+    roundtrip(message, 300, expected, 303);
+}
+
+void test_segments_as_one_message() {
+    const uint8_t a[] = {1, 0, 2}, b[] = {0, 0}, c[] = {3};
+    const uint8_t whole[] = {1, 0, 2, 0, 0, 3};
+    Sink segmented, single;
+    TEST_ASSERT_TRUE(Cobs::write(&segmented, Segment{a, sizeof(a)}, Segment{b, sizeof(b)}, Segment{c, sizeof(c)}));
+    TEST_ASSERT_TRUE(Cobs::write(&single, Segment{whole, sizeof(whole)}));
+    TEST_ASSERT_EQUAL(single.size, segmented.size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(single.data, segmented.data, single.size);
+    // No zero inside, one delimiter at the end
+    TEST_ASSERT_NULL(memchr(single.data, 0, single.size - 1));
+    TEST_ASSERT_EQUAL_HEX8(0x00, single.data[single.size - 1]);
+}
+
+void test_decode_in_place_and_malformed() {
+    uint8_t data[] = {0x03, 0x11, 0x22, 0x02, 0x33};
+    size_t length = 0;
+    TEST_ASSERT_TRUE(Cobs::decode(data, sizeof(data), data, &length, sizeof(data)));
+    TEST_ASSERT_EQUAL(4, length);
+    const uint8_t expected[] = {0x11, 0x22, 0x00, 0x33};
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, data, length);
+
+    uint8_t output[8];
+    const uint8_t truncated[] = {0x05, 0x11, 0x22};
+    TEST_ASSERT_FALSE(Cobs::decode(truncated, sizeof(truncated), output, &length, sizeof(output)));
+    const uint8_t inner[] = {0x03, 0x11, 0x00};
+    TEST_ASSERT_FALSE(Cobs::decode(inner, sizeof(inner), output, &length, sizeof(output)));
+    const uint8_t mixed[] = {0x03, 0x11, 0x22, 0x02, 0x33};
+    TEST_ASSERT_FALSE(Cobs::decode(mixed, sizeof(mixed), output, &length, 3));
+    TEST_ASSERT_FALSE(Cobs::decode(mixed, 0, output, &length, sizeof(output)));
+}
+
+void test_one_write_per_message() {
+    const uint8_t message[] = {1, 0, 2, 0, 0, 3, 4, 0};
+    Sink sink;
+    TEST_ASSERT_TRUE(Cobs::write(&sink, Segment{message, sizeof(message)}));
+    TEST_ASSERT_EQUAL(1, sink.writes);
+    // Longer than the caller's maximum: nothing is written
+    TEST_ASSERT_FALSE(Cobs::write<sizeof(message) - 1>(&sink, Segment{message, sizeof(message)}));
+    TEST_ASSERT_EQUAL(1, sink.writes);
+}
+
+// All-or-nothing stream with room for a few bytes, as HardwareUART with a nearly full queue
+struct ShortSink : Sink {
+    size_t room = 5;
+    size_t write(const uint8_t *buffer, size_t length) {
+        if (length > room)
+            return 0;
+        room -= length;
+        return Sink::write(buffer, length);
+    }
+};
+
+void test_short_write() {
+    const uint8_t message[] = {1, 0, 2, 0, 0, 3, 4, 0};
+    ShortSink sink;
+    // No partial message on the wire to run into the next one
+    TEST_ASSERT_FALSE(Cobs::write(&sink, Segment{message, sizeof(message)}));
+    TEST_ASSERT_EQUAL(0, sink.size);
+    sink.room = Cobs::maxSize(sizeof(message));
+    TEST_ASSERT_TRUE(Cobs::write(&sink, Segment{message, sizeof(message)}));
+    size_t length = sink.size;
+    const uint8_t *decoded = Cobs::unwrap(sink.data, &length);
+    TEST_ASSERT_NOT_NULL(decoded);
+    TEST_ASSERT_EQUAL(sizeof(message), length);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(message, decoded, sizeof(message));
+}
+
+void test_reader_resynchronizes() {
+    Framed sender, receiver;
+    sender.begin();
+    receiver.begin();
+    Cobs::Reader<Framed::k_maxWireSize> reader;
+    Serialization::RawData input = {0, 1000, 0, 1000}, output;
+    size_t received = 0, rejected = 0;
+    for (int n = 0; n < 50; ++n) {
+        input[n % 4] = static_cast<uint16_t>(rand() % 1001);
+        Sink sink;
+        TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+        TEST_ASSERT_LESS_OR_EQUAL(Framed::k_maxWireSize, sink.size);
+        // One message short of a byte, another with a spurious one, a third starts in the middle
+        if (n == 10)
+            memmove(sink.data + 1, sink.data + 2, --sink.size - 1);
+        if (n == 20)
+            sink.data[sink.size++ - 1] = 0x5A, sink.data[sink.size - 1] = 0x00;
+        size_t from = (n == 30) ? sink.size / 2 : 0;
+        for (size_t i = from; i < sink.size; ++i) {
+            size_t size;
+            uint8_t *frame = reader.push(sink.data[i], &size);
+            if (!frame)
+                continue;
+            if (receiver.deserialize(frame, size, &output)) {
+                TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+                ++received;
+            } else {
+                ++rejected;
+            }
+        }
+    }
+    // Only the damaged messages are lost
+    TEST_ASSERT_EQUAL(3, rejected);
+    TEST_ASSERT_EQUAL(47, received);
+}
+
+void test_reader_overflow() {
+    Cobs::Reader<4> reader;
+    size_t size;
+    const uint8_t noise[] = {1, 2, 3, 4, 5, 6, 0};
+    for (auto byte : noise)
+        TEST_ASSERT_NULL(reader.push(byte, &size));
+    TEST_ASSERT_EQUAL(1, reader.dropped());
+    const uint8_t message[] = {0x02, 0x7F, 0x00};
+    TEST_ASSERT_NULL(reader.push(message[0], &size));
+    TEST_ASSERT_NULL(reader.push(message[1], &size));
+    const uint8_t *frame = reader.push(message[2], &size);
+    TEST_ASSERT_NOT_NULL(frame);
+    TEST_ASSERT_EQUAL(2, size);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, frame[1]);
+}
+
+void test_unwrap_skips_delimiters() {
+    // Leading delimiters and whatever follows the message are not part of it
+    uint8_t data[] = {0x00, 0x00, 0x03, 0x11, 0x22, 0x02, 0x33, 0x00, 0x05};
+    size_t length = sizeof(data);
+    const uint8_t *message = Cobs::unwrap(data, &length);
+    TEST_ASSERT_EQUAL_PTR(data + 2, message);
+    const uint8_t expected[] = {0x11, 0x22, 0x00, 0x33};
+    TEST_ASSERT_EQUAL(sizeof(expected), length);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, message, length);
+    uint8_t truncated[] = {0x00, 0x05, 0x11};
+    length = sizeof(truncated);
+    TEST_ASSERT_NULL(Cobs::unwrap(truncated, &length));
+}
@@ -0,0 +1,92 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_known_encodings();
+extern void test_long_runs();
+extern void test_segments_as_one_message();
+extern void test_decode_in_place_and_malformed();
+extern void test_one_write_per_message();
+extern void test_short_write();
+extern void test_reader_resynchronizes();
+extern void test_reader_overflow();
+extern void test_unwrap_skips_delimiters();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/logic/test_Cobs/test.cpp");
+  run_test(test_known_encodings, "test_known_encodings", 38);
+  run_test(test_long_runs, "test_long_runs", 47);
+  run_test(test_segments_as_one_message, "test_segments_as_one_message", 63);
+  run_test(test_decode_in_place_and_malformed, "test_decode_in_place_and_malformed", 76);
+  run_test(test_one_write_per_message, "test_one_write_per_message", 94);
+  run_test(test_short_write, "test_short_write", 115);
+  run_test(test_reader_resynchronizes, "test_reader_resynchronizes", 130);
+  run_test(test_reader_overflow, "test_reader_overflow", 166);
+  run_test(test_unwrap_skips_delimiters, "test_unwrap_skips_delimiters", 182);
+
+  return UnityEnd();
+}
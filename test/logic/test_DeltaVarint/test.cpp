@@ -0,0 +1,83 @@
+// test\logic\test_DeltaVarint\test.cpp - delta coding for the user config
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include "Serialization/Packing/DeltaVarint.h"
+
+using Packing = Serialization::detail_::Packing::DeltaVarint;
+
+void test_varint_zigzag() {
+    const int32_t values[] = {0, -1, 1, -64, 63, 64, -1000, 1000};
+    for (auto value : values) {
+        uint8_t buffer[Tool::Varint::maxSize<uint32_t>()];
+        const size_t size = Tool::Varint::encode(Tool::Varint::zigzag(value), buffer);
+        uint32_t decoded = 0;
+        TEST_ASSERT_EQUAL(size, Tool::Varint::decode(buffer, size, &decoded));
+        TEST_ASSERT_EQUAL(value, Tool::Varint::unzigzag(decoded));
+        // truncated
+        TEST_ASSERT_EQUAL(0, Tool::Varint::decode(buffer, size - 1, &decoded));
+    }
+}
+
+void test_roundtrip_sequence() {
+    Packing sender, receiver;
+    Serialization::RawData input = {12, 34, 56, 0};
+    for (int n = 0; n < 100; ++n) {
+        // slowly changing channels with an occasional jump
+        input[3] = static_cast<uint16_t>(n % 7 ? input[3] + 1 : rand() % 1001);
+        uint8_t buffer[Packing::k_maxSize];
+        const size_t size = sender.pack(input, buffer);
+        TEST_ASSERT_LESS_OR_EQUAL(Packing::k_maxSize, size);
+
+        Serialization::RawData output;
+        TEST_ASSERT_EQUAL(size, receiver.unpack(buffer, size, &output));
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+    }
+}
+
+void test_unchanged_is_short() {
+    Packing sender;
+    Serialization::RawData input = {1, 2, 3, 4};
+    uint8_t buffer[Packing::k_maxSize];
+    TEST_ASSERT_EQUAL(Packing::Keyframe, (sender.pack(input, buffer), buffer[0]));
+    TEST_ASSERT_EQUAL(2, sender.pack(input, buffer));
+    TEST_ASSERT_EQUAL(Packing::Delta, buffer[0]);
+    input[1] = 3;
+    TEST_ASSERT_EQUAL(3, sender.pack(input, buffer));
+}
+
+void test_delta_needs_keyframe() {
+    Packing sender, receiver;
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+    uint8_t keyframe[Packing::k_maxSize], delta[Packing::k_maxSize];
+    const size_t keyframeSize = sender.pack(input, keyframe);
+    const size_t deltaSize = sender.pack(input, delta);
+    // keyframe lost
+    TEST_ASSERT_EQUAL(0, receiver.unpack(delta, deltaSize, &output));
+    TEST_ASSERT_EQUAL(keyframeSize, receiver.unpack(keyframe, keyframeSize, &output));
+    TEST_ASSERT_EQUAL(deltaSize, receiver.unpack(delta, deltaSize, &output));
+}
+
+void test_periodic_keyframe() {
+    Packing sender;
+    Serialization::RawData input = {1, 2, 3, 4};
+    uint8_t buffer[Packing::k_maxSize];
+    for (int n = 0; n < 40; ++n) {
+        sender.pack(input, buffer);
+        TEST_ASSERT_EQUAL(n % 16 ? Packing::Delta : Packing::Keyframe, buffer[0]);
+    }
+}
+
+void test_max_delta_size_is_reached() {
+    Packing sender;
+    Serialization::RawData low, high;
+    for (size_t i = 0; i < low.size(); ++i) {
+        low[i] = static_cast<uint16_t>(Config::schema::minimal[i]);
+        high[i] = static_cast<uint16_t>(Config::schema::maximum[i]);
+    }
+    uint8_t buffer[Packing::k_maxDeltaSize];
+    sender.reference(low);
+    // Full range up and down, the bound is exact: no byte per element is wasted
+    TEST_ASSERT_EQUAL(Packing::k_maxDeltaSize, sender.packDelta(high, buffer));
+    TEST_ASSERT_EQUAL(Packing::k_maxDeltaSize, sender.packDelta(low, buffer));
+}
@@ -0,0 +1,85 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Serialization/Packing/DeltaVarint.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_varint_zigzag();
+extern void test_roundtrip_sequence();
+extern void test_unchanged_is_short();
+extern void test_delta_needs_keyframe();
+extern void test_periodic_keyframe();
+extern void test_max_delta_size_is_reached();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/logic/test_DeltaVarint/test.cpp");
+  run_test(test_varint_zigzag, "test_varint_zigzag", 9);
+  run_test(test_roundtrip_sequence, "test_roundtrip_sequence", 22);
+  run_test(test_unchanged_is_short, "test_unchanged_is_short", 38);
+  run_test(test_delta_needs_keyframe, "test_delta_needs_keyframe", 49);
+  run_test(test_periodic_keyframe, "test_periodic_keyframe", 61);
+  run_test(test_max_delta_size_is_reached, "test_max_delta_size_is_reached", 71);
+
+  return UnityEnd();
+}
@@ -2,8 +2,11 @@
 #include <unity.h>
 void setUp() {} void tearDown() {}
 
+#include <algorithm>
+#include "Serialization/Config/DataFormat.h"
 #include "Serialization/Hash/CrcHardware.h"
 #include "Serialization/Hash/CrcSoftware.h"
+#include "Serialization/Hash/SumSoftware.h"
 
 template<typename THasher>
 void ordinary() {
@@ -87,3 +90,113 @@ void test_forced_crc8_collision() {
     TEST_ASSERT_NOT_EQUAL_HEX32(crc1, crc2);
     TEST_ASSERT_TRUE(__builtin_memcmp( data1.data(), data2.data(), sizeof( Type ) ) != 0);
 }
+
+void test_crc8_check_value() {
+    // CRC-8 (poly 0x07, init 0) check value of "123456789"
+    const char check[] = "123456789";
+    Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Bitwise> bitwise;
+    Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Table> table;
+    Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Slicing4> slicing;
+    TEST_ASSERT_EQUAL_HEX8(0xF4, bitwise.calculate(check, 9));
+    TEST_ASSERT_EQUAL_HEX8(0xF4, table.calculate(check, 9));
+    TEST_ASSERT_EQUAL_HEX8(0xF4, slicing.calculate(check, 9));
+}
+
+void test_crc8_methods_agree() {
+    Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Bitwise> bitwise;
+    Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Table> table;
+    Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Slicing4> slicing;
+    uint8_t data[67];
+    for (auto &value : data) 
+        value = rand();
+    // every tail length of the slicing loop
+    for (size_t size = 0; size <= sizeof(data); ++size) {
+        const uint8_t expected = bitwise.calculate(data, size);
+        TEST_ASSERT_EQUAL_HEX8(expected, table.calculate(data, size));
+        TEST_ASSERT_EQUAL_HEX8(expected, slicing.calculate(data, size));
+    }
+}
+
+template<typename THasher>
+void streaming() {
+    THasher hasher;
+    hasher.begin();
+    alignas(4) uint8_t data[61];
+    for (auto &value : data) 
+        value = rand();
+    const auto expected = hasher.calculate(data, sizeof(data));
+    // pieces of every size, unaligned tails cross update() boundaries
+    for (size_t piece = 1; piece <= 9; ++piece) {
+        hasher.init();
+        for (size_t offset = 0; offset < sizeof(data); offset += piece)
+            hasher.update(data + offset, std::min(piece, sizeof(data) - offset));
+        TEST_ASSERT_EQUAL_HEX32(expected, hasher.finalize());
+    }
+    // a tag byte before an aligned buffer leaves its words unaligned
+    const uint8_t tag = 0x5A;
+    uint8_t tagged[1 + sizeof(data)] = { tag };
+    memcpy(tagged + 1, data, sizeof(data));
+    hasher.init();
+    hasher.update(&tag, sizeof(tag));
+    hasher.update(data, sizeof(data));
+    TEST_ASSERT_EQUAL_HEX32(hasher.calculate(tagged, sizeof(tagged)), hasher.finalize());
+    // header followed by a payload in place
+    Serialization::detail_::PackedData payload;
+    for (auto &value : payload) 
+        value = rand();
+    uint8_t message[1 + sizeof(payload)] = { 0x5A };
+    memcpy(message + 1, payload.data(), sizeof(payload));
+    hasher.init();
+    hasher.update(message, 1);
+    hasher.update(Serialization::detail_::PackedView(payload));
+    TEST_ASSERT_EQUAL_HEX32(hasher.calculate(message, sizeof(message)), hasher.finalize());
+}
+
+void test_streaming_CrcHardware() {
+    streaming<Serialization::detail_::Hash::CrcHardware>( );
+}
+
+void test_streaming_CrcSoftware() {
+    streaming<Serialization::detail_::Hash::CrcSoftwareTpl<Serialization::detail_::Hash::CrcMethod::Slicing4>>( );
+}
+
+void test_streaming_SumSoftware() {
+    streaming<Serialization::detail_::Hash::SumSoftware>( );
+}
+
+template<typename TParameters>
+void check_value(uint32_t expected) {
+    using namespace Serialization::detail_::Hash;
+    const char check[] = "123456789";
+    CrcSoftwareTpl<CrcMethod::Bitwise, TParameters> bitwise;
+    CrcSoftwareTpl<CrcMethod::Table, TParameters> table;
+    CrcSoftwareTpl<CrcMethod::Slicing4, TParameters> slicing;
+    TEST_ASSERT_EQUAL_HEX32(expected, bitwise.calculate(check, 9));
+    TEST_ASSERT_EQUAL_HEX32(expected, table.calculate(check, 9));
+    TEST_ASSERT_EQUAL_HEX32(expected, slicing.calculate(check, 9));
+
+    uint8_t data[67];
+    for (auto &value : data) 
+        value = rand();
+    for (size_t size = 0; size <= sizeof(data); ++size) {
+        const auto reference = bitwise.calculate(data, size);
+        TEST_ASSERT_EQUAL_HEX32(reference, table.calculate(data, size));
+        TEST_ASSERT_EQUAL_HEX32(reference, slicing.calculate(data, size));
+    }
+}
+
+void test_crc16_ccitt() {
+    check_value<Serialization::detail_::Hash::Crc::Ccitt16>(0x29B1);
+}
+
+void test_crc32() {
+    check_value<Serialization::detail_::Hash::Crc::Crc32>(0xCBF43926);
+}
+
+void test_crc32_detects_crc8_collision() {
+    // Same pair as in test_forced_crc8_collision
+    Serialization::detail_::Hash::Crc32Software crc;
+    const uint8_t data1[] = {0x31, 0x32, 0x33, 0x34, 0x35};
+    const uint8_t data2[] = {0x72, 0xDF, 0x80, 0x1A, 0x3B};
+    TEST_ASSERT_NOT_EQUAL_HEX32(crc.calculate(data1, sizeof(data1)), crc.calculate(data2, sizeof(data2)));
+}
@@ -2,8 +2,10 @@
 
 /*=======Automagically Detected Files To Include=====*/
 #include "unity.h"
+#include "Serialization/Config/DataFormat.h"
 #include "Serialization/Hash/CrcHardware.h"
 #include "Serialization/Hash/CrcSoftware.h"
+#include "Serialization/Hash/SumSoftware.h"
 
 /*=======External Functions This Runner Calls=====*/
 extern void setUp(void);
@@ -15,6 +17,14 @@ extern void test_first_CrcSoftware();
 extern void test_lucky_CrcHardware();
 extern void test_lucky_CrcSoftware();
 extern void test_forced_crc8_collision();
+extern void test_crc8_check_value();
+extern void test_crc8_methods_agree();
+extern void test_streaming_CrcHardware();
+extern void test_streaming_CrcSoftware();
+extern void test_streaming_SumSoftware();
+extern void test_crc16_ccitt();
+extern void test_crc32();
+extern void test_crc32_detects_crc8_collision();
 
 
 /*=======Mock Management=====*/
@@ -76,13 +86,21 @@ static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE l
 int main(void)
 {
   UnityBegin("test/logic/test_Hashing/test.cpp");
-  run_test(test_ordinary_CrcHardware, "test_ordinary_CrcHardware", 19);
-  run_test(test_ordinary_CrcSoftware, "test_ordinary_CrcSoftware", 23);
-  run_test(test_first_CrcHardware, "test_first_CrcHardware", 42);
-  run_test(test_first_CrcSoftware, "test_first_CrcSoftware", 46);
-  run_test(test_lucky_CrcHardware, "test_lucky_CrcHardware", 67);
-  run_test(test_lucky_CrcSoftware, "test_lucky_CrcSoftware", 71);
-  run_test(test_forced_crc8_collision, "test_forced_crc8_collision", 75);
+  run_test(test_ordinary_CrcHardware, "test_ordinary_CrcHardware", 22);
+  run_test(test_ordinary_CrcSoftware, "test_ordinary_CrcSoftware", 26);
+  run_test(test_first_CrcHardware, "test_first_CrcHardware", 45);
+  run_test(test_first_CrcSoftware, "test_first_CrcSoftware", 49);
+  run_test(test_lucky_CrcHardware, "test_lucky_CrcHardware", 70);
+  run_test(test_lucky_CrcSoftware, "test_lucky_CrcSoftware", 74);
+  run_test(test_forced_crc8_collision, "test_forced_crc8_collision", 78);
+  run_test(test_crc8_check_value, "test_crc8_check_value", 94);
+  run_test(test_crc8_methods_agree, "test_crc8_methods_agree", 105);
+  run_test(test_streaming_CrcHardware, "test_streaming_CrcHardware", 147);
+  run_test(test_streaming_CrcSoftware, "test_streaming_CrcSoftware", 151);
+  run_test(test_streaming_SumSoftware, "test_streaming_SumSoftware", 155);
+  run_test(test_crc16_ccitt, "test_crc16_ccitt", 180);
+  run_test(test_crc32, "test_crc32", 184);
+  run_test(test_crc32_detects_crc8_collision, "test_crc32_detects_crc8_collision", 188);
 
   return UnityEnd();
 }
@@ -0,0 +1,141 @@
+// test\logic\test_Multiplexer\test.cpp - several message types over one stream
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include "Logger.h"
+#include "Serialization/Multiplexer.h"
+
+namespace Codec = Serialization::detail_::Codec;
+namespace Framing = Serialization::detail_::Framing;
+using Telemetry = Serialization::Channel<1, Codec::Telemetry<>>;
+using Command = Serialization::Channel<2, Codec::Bytes<8>>;
+using Log = Serialization::Channel<7, Codec::Bytes<200>>;
+template<typename Framing>
+using Mux = Serialization::MultiplexerTpl<Serialization::detail_::Hasher, Framing, Telemetry, Command, Log>;
+
+// Stream collecting everything written
+struct Sink {
+    uint8_t data[2048];
+    size_t size = 0;
+    size_t write(const uint8_t *buffer, size_t length) {
+        memcpy(data + size, buffer, length);
+        size += length;
+        return length;
+    }
+};
+
+// Receiving node: one overload per channel
+struct Node {
+    Serialization::RawData telemetry = { };
+    uint8_t command[8] = { };
+    size_t commands = 0, logs = 0, logSize = 0;
+    void operator()(Telemetry, Telemetry::Type const& value) {
+        telemetry = value;
+    }
+    void operator()(Command, Command::Type const& value) {
+        memcpy(command, value.data, value.size);
+        ++commands;
+    }
+    void operator()(Log, Log::Type const& value) {
+        logSize = value.size;
+        ++logs;
+    }
+};
+
+void test_header_layout() {
+    static_assert(Mux<Framing::Raw>::k_maxId == 7, "Table up to the largest id");
+    static_assert(Mux<Framing::Raw>::k_maxHeaderSize == 1 + 2, "200 bytes take a two-byte length");
+    Mux<Framing::Raw> mux;
+    mux.begin();
+    Sink sink;
+    const uint8_t command[] = {0xC0, 0xDE};
+    TEST_ASSERT_TRUE(mux.send<Command>({command, sizeof(command)}, &sink));
+    TEST_ASSERT_EQUAL_HEX8(2, sink.data[0]);
+    TEST_ASSERT_EQUAL_HEX8(sizeof(command), sink.data[1]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(command, sink.data + 2, sizeof(command));
+    TEST_ASSERT_EQUAL(2 + sizeof(command) + sizeof(Serialization::detail_::HashReturnType), sink.size);
+    TEST_ASSERT_EQUAL(sink.size, Mux<Framing::Raw>::messageSize(sink.data, sink.size));
+    TEST_ASSERT_EQUAL(0, Mux<Framing::Raw>::messageSize(sink.data, 1));
+
+    // Too long for the channel
+    uint8_t longCommand[9] = { };
+    TEST_ASSERT_FALSE(mux.send<Command>({longCommand, sizeof(longCommand)}, &sink));
+}
+
+void test_interleaved_stream_raw() {
+    Mux<Framing::Raw> sender, receiver;
+    sender.begin();
+    receiver.begin();
+    Sink sink;
+    const Serialization::RawData telemetry = {1, 2, 3, 4};
+    const uint8_t command[] = {'G', 'O'};
+    uint8_t log[150];
+    memset(log, 'x', sizeof(log));
+    TEST_ASSERT_TRUE(sender.send<Log>({log, sizeof(log)}, &sink));
+    TEST_ASSERT_TRUE(sender.send<Telemetry>(telemetry, &sink));
+    TEST_ASSERT_TRUE(sender.send<Command>({command, sizeof(command)}, &sink));
+
+    // Byte-stream reader: the header tells the size
+    Node node;
+    size_t offset = 0, messages = 0;
+    while (offset < sink.size) {
+        const size_t size = Mux<Framing::Raw>::messageSize(sink.data + offset, sink.size - offset);
+        TEST_ASSERT_TRUE(size && size <= sink.size - offset);
+        TEST_ASSERT_TRUE(receiver.dispatch(sink.data + offset, size, node));
+        offset += size;
+        ++messages;
+    }
+    TEST_ASSERT_EQUAL(3, messages);
+    TEST_ASSERT_EQUAL(1, node.logs);
+    TEST_ASSERT_EQUAL(sizeof(log), node.logSize);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(telemetry.data(), node.telemetry.data(), telemetry.size());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(command, node.command, sizeof(command));
+}
+
+void test_rejects_damaged_and_unknown() {
+    Mux<Framing::Raw> mux;
+    mux.begin();
+    Node node;
+    Sink sink;
+    const uint8_t command[] = {1, 2, 3};
+    TEST_ASSERT_TRUE(mux.send<Command>({command, sizeof(command)}, &sink));
+    sink.data[3] ^= 0x01;
+    TEST_ASSERT_FALSE(mux.dispatch(sink.data, sink.size, node));
+    sink.data[3] ^= 0x01;
+    TEST_ASSERT_FALSE(mux.dispatch(sink.data, sink.size - 1, node));
+    TEST_ASSERT_TRUE(mux.dispatch(sink.data, sink.size, node));
+
+    // Unknown id with a valid hash
+    sink.data[0] = 5;
+    Serialization::detail_::Hasher hasher;
+    const auto hash = hasher.calculate(sink.data, 2 + sizeof(command));
+    memcpy(sink.data + 2 + sizeof(command), &hash, sizeof(hash));
+    TEST_ASSERT_FALSE(mux.dispatch(sink.data, sink.size, node));
+    TEST_ASSERT_EQUAL(1, node.commands);
+}
+
+void test_cobs_generic_handler() {
+    Mux<Framing::Cobs> sender, receiver;
+    sender.begin();
+    receiver.begin();
+    Sink sink;
+    for (uint16_t n = 0; n < 10; ++n)
+        TEST_ASSERT_TRUE(sender.send<Telemetry>({n, 0, n, 0}, &sink));
+    Framing::Cobs::Reader<Mux<Framing::Cobs>::k_maxWireSize> reader;
+    size_t received = 0;
+    uint16_t last = 0;
+    // Starts in the middle of the first message
+    for (size_t i = 3; i < sink.size; ++i) {
+        size_t size;
+        uint8_t *frame = reader.push(sink.data[i], &size);
+        if (!frame)
+            continue;
+        receiver.dispatch(frame, size, [&](auto channel, auto const& value) {
+            if constexpr (decltype(channel)::id == Telemetry::id)
+                last = value[0];
+            ++received;
+        });
+    }
+    TEST_ASSERT_EQUAL(9, received);
+    TEST_ASSERT_EQUAL(9, last);
+}
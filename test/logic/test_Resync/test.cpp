@@ -0,0 +1,101 @@
+// test\logic\test_Resync\test.cpp - frame boundaries found again in a slipped byte stream
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+
+constexpr size_t k_frameSize = Serialization::Serializer::k_frameSize;
+using Resync = Serialization::detail_::Framing::Resync<k_frameSize>;
+using State = Resync::State;
+
+// Stream collecting everything written
+struct Sink {
+    uint8_t data[4096];
+    size_t size = 0;
+    size_t write(const uint8_t *buffer, size_t length) {
+        memcpy(data + size, buffer, length);
+        size += length;
+        return length;
+    }
+};
+
+static Serialization::Serializer g_serializer;
+static Serialization::RawData g_sent[512];
+static Sink g_sink;
+
+// Frames with distinct content back-to-back
+static void send(size_t count) {
+    g_serializer.begin();
+    g_sink.size = 0;
+    for (size_t n = 0; n < count; ++n) {
+        for (auto &value : g_sent[n])
+            value = static_cast<uint16_t>(rand() % 1001);
+        TEST_ASSERT_TRUE(g_serializer.serialize(g_sent[n], &g_sink));
+    }
+}
+
+// Feeds the bytes, counts delivered frames that match a sent one
+static size_t feed(Resync &sync, const uint8_t *data, size_t size, size_t *wrong) {
+    size_t delivered = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (!sync.push(data[i], [](const uint8_t *frame) { return g_serializer.verify(frame, k_frameSize); }))
+            continue;
+        Serialization::RawData output;
+        TEST_ASSERT_TRUE(g_serializer.deserialize(sync.frame(), k_frameSize, &output));
+        bool known = false;
+        for (const auto &sent : g_sent)
+            known = known || sent == output;
+        *wrong += !known;
+        ++delivered;
+    }
+    return delivered;
+}
+
+void test_aligned_locks_after_three() {
+    send(10);
+    Resync sync;
+    size_t wrong = 0;
+    TEST_ASSERT_EQUAL(0, feed(sync, g_sink.data, 2 * k_frameSize, &wrong));
+    TEST_ASSERT_TRUE(State::Verifying == sync.state());
+    TEST_ASSERT_EQUAL(8, feed(sync, g_sink.data + 2 * k_frameSize, g_sink.size - 2 * k_frameSize, &wrong));
+    TEST_ASSERT_TRUE(State::Locked == sync.state());
+    TEST_ASSERT_EQUAL(0, wrong);
+}
+
+void test_starts_mid_frame() {
+    send(200);
+    for (size_t offset = 1; offset < k_frameSize; ++offset) {
+        Resync sync;
+        size_t wrong = 0;
+        const size_t delivered = feed(sync, g_sink.data + offset, g_sink.size - offset, &wrong);
+        TEST_ASSERT_TRUE(State::Locked == sync.state());
+        // A few frames to hunt and verify, random matches of a short hash included
+        TEST_ASSERT_GREATER_OR_EQUAL(190, delivered);
+        TEST_ASSERT_EQUAL(0, wrong);
+    }
+}
+
+void test_slip_loses_and_reacquires() {
+    send(200);
+    Resync sync;
+    size_t wrong = 0;
+    const size_t half = 100 * k_frameSize;
+    TEST_ASSERT_EQUAL(98, feed(sync, g_sink.data, half, &wrong));
+    // One byte lost on the line
+    const size_t delivered = feed(sync, g_sink.data + half + 1, g_sink.size - half - 1, &wrong);
+    TEST_ASSERT_EQUAL(1, sync.losses());
+    TEST_ASSERT_TRUE(State::Locked == sync.state());
+    TEST_ASSERT_GREATER_OR_EQUAL(90, delivered);
+    TEST_ASSERT_EQUAL(0, wrong);
+}
+
+void test_damaged_frame_keeps_lock() {
+    send(20);
+    g_sink.data[10 * k_frameSize + 1] ^= 0x10;
+    Resync sync;
+    size_t wrong = 0;
+    TEST_ASSERT_EQUAL(17, feed(sync, g_sink.data, g_sink.size, &wrong));
+    TEST_ASSERT_EQUAL(0, sync.losses());
+    TEST_ASSERT_EQUAL(0, wrong);
+}
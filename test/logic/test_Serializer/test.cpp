@@ -0,0 +1,453 @@
+// test\logic\test_Serializer\test.cpp - serializer with the user config
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+
+// Stream collecting everything written
+struct Sink {
+    uint8_t data[256];
+    size_t size = 0;
+    size_t write(char c) {
+        data[size++] = c;
+        return sizeof(c);
+    }
+    size_t write(const uint8_t *buffer, size_t length) {
+        memcpy(data + size, buffer, length);
+        size += length;
+        return length;
+    }
+};
+
+constexpr size_t k_count = 8;
+using BatchHash = Serialization::Serializer::BatchHash;
+
+void fill(Serialization::RawData (&frames)[k_count]) {
+    for (auto &frame : frames)
+        for (auto &value : frame)
+            value = static_cast<uint16_t>(rand() % 1001);
+}
+
+void batch_roundtrip(BatchHash mode) {
+    Serialization::Serializer serializer;
+    serializer.begin();
+    Serialization::RawData input[k_count], output[k_count];
+    fill(input);
+    uint8_t buffer[Serialization::Serializer::batchSize(k_count, BatchHash::PerFrame)];
+    const size_t size = serializer.serializeBatch(input, k_count, buffer, sizeof(buffer), mode);
+    TEST_ASSERT_EQUAL(Serialization::Serializer::batchSize(k_count, mode), size);
+    TEST_ASSERT_TRUE(serializer.deserializeBatch(buffer, size, output, k_count, mode));
+    for (size_t i = 0; i < k_count; ++i)
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(input[i].data(), output[i].data(), input[i].size());
+
+    // damage
+    buffer[size / 2] ^= 'A';
+    TEST_ASSERT_FALSE(serializer.deserializeBatch(buffer, size, output, k_count, mode));
+}
+
+void test_batch_single_hash() {
+    batch_roundtrip(BatchHash::Single);
+}
+
+void test_batch_per_frame_hash() {
+    batch_roundtrip(BatchHash::PerFrame);
+}
+
+void test_batch_per_frame_as_serialize() {
+    Serialization::Serializer serializer;
+    serializer.begin();
+    Serialization::RawData input[k_count];
+    fill(input);
+    Sink sink;
+    for (auto const& frame : input)
+        TEST_ASSERT_TRUE(serializer.serialize(frame, &sink));
+
+    uint8_t buffer[Serialization::Serializer::batchSize(k_count, BatchHash::PerFrame)];
+    const size_t size = serializer.serializeBatch(input, k_count, buffer, sizeof(buffer), BatchHash::PerFrame);
+    TEST_ASSERT_EQUAL(sink.size, size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(sink.data, buffer, size);
+}
+
+void test_batch_small_buffer() {
+    Serialization::Serializer serializer;
+    serializer.begin();
+    Serialization::RawData input[k_count];
+    fill(input);
+    uint8_t buffer[Serialization::Serializer::batchSize(k_count) - 1];
+    TEST_ASSERT_EQUAL(0, serializer.serializeBatch(input, k_count, buffer, sizeof(buffer)));
+    TEST_ASSERT_FALSE(serializer.deserializeBatch(buffer, sizeof(buffer), input, k_count));
+}
+
+void test_deserialize_in_place() {
+    Serialization::Serializer serializer;
+    serializer.begin();
+    Serialization::RawData input = {1, 500, 999, 1000}, output;
+    Sink sink;
+    // frame at an odd offset, as inside a receive buffer
+    sink.size = 3;
+    TEST_ASSERT_TRUE(serializer.serialize(input, &sink));
+    const Serialization::detail_::PackedView view(sink.data + 3);
+    TEST_ASSERT_EQUAL_PTR(sink.data + 3, view.data());
+    TEST_ASSERT_EQUAL(Serialization::detail_::k_hashOffset, view.size());
+    TEST_ASSERT_TRUE(serializer.deserialize(sink.data + 3, sink.size - 3, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+
+    // same result as unpacking a copy
+    Serialization::detail_::PackedData copy;
+    memcpy(copy.data(), view.data(), view.size());
+    Serialization::RawData fromCopy;
+    Serialization::detail_::Packing::viaBitReader::unpack(copy, &fromCopy);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(output.data(), fromCopy.data(), output.size());
+}
+
+using Encoding = Serialization::Serializer::Encoding;
+
+void test_repeat_token() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::SuppressRepeats);
+    receiver.begin(Encoding::SuppressRepeats);
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL(Serialization::Serializer::messageSize(sink.data[0], Encoding::SuppressRepeats), sink.size);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+
+    // token carries hash bits of the frame it repeats
+    const uint8_t hash = sink.data[sink.size - 1];
+    for (uint8_t n = 1; n < 4; ++n) {
+        sink.size = 0;
+        TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+        TEST_ASSERT_EQUAL(1, sink.size);
+        TEST_ASSERT_EQUAL_HEX8(0x80 | (hash & 0x7F), sink.data[0]);
+        output = { };
+        TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+    }
+
+    // changed frame is sent in full
+    input[0] = 5;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL(1 + Serialization::detail_::k_frameSize, sink.size);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_repeat_without_frame() {
+    Serialization::Serializer receiver;
+    receiver.begin(Encoding::SuppressRepeats);
+    const uint8_t token = 0x81;
+    Serialization::RawData output;
+    TEST_ASSERT_FALSE(receiver.deserialize(&token, sizeof(token), &output));
+}
+
+void test_repeat_after_rejected_frame() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::SuppressRepeats);
+    receiver.begin(Encoding::SuppressRepeats);
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+
+    // damaged full frame, then a repeat of it
+    input = {5, 6, 7, 8};
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    sink.data[2] ^= 0x01;
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL(1, sink.size);
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+}
+
+void test_repeat_of_lost_frame() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::SuppressRepeats);
+    receiver.begin(Encoding::SuppressRepeats);
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    const uint8_t first = sink.data[0];
+
+    // full frame lost on the line, then repeated: the token names the lost frame
+    input = {5, 6, 7, 8};
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL(1, sink.size);
+    TEST_ASSERT_NOT_EQUAL(first, sink.data[0]);
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+}
+
+// Stream with a full queue, rejects every write
+struct FullSink {
+    size_t write(char) { return 0; }
+    size_t write(const uint8_t *, size_t) { return 0; }
+};
+
+void test_rejected_write() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::SuppressRepeats);
+    receiver.begin(Encoding::SuppressRepeats);
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+    Sink sink;
+    FullSink full;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+
+    // back-pressure: the frame did not leave, it is not repeated by a token
+    input = {5, 6, 7, 8};
+    TEST_ASSERT_FALSE(sender.serialize(input, &full));
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL(1 + Serialization::detail_::k_frameSize, sink.size);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_adaptive_rejected_write() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::Adaptive);
+    receiver.begin(Encoding::Adaptive);
+    Serialization::RawData input = {10, 20, 30, 40}, output;
+    Sink sink;
+    FullSink full;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+
+    // delta rejected by the stream, the next one is still against the frame the receiver has
+    input[3] = 50;
+    TEST_ASSERT_FALSE(sender.serialize(input, &full));
+    input[3] = 51;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(Serialization::detail_::Tag::isDelta(sink.data[0]));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_tag_is_hashed() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::Adaptive);
+    receiver.begin(Encoding::Adaptive);
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    input = {1000, 0, 1000, 0};
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL_HEX8(0x00, sink.data[0]);
+    // same payload and hash read as a delta of the same length
+    sink.data[0] = static_cast<uint8_t>(0x40 | (sink.size - 2));
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+    // bit 7 flipped: a repeat token that counts nothing
+    sink.data[0] = 0x80;
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+    sink.data[0] = 0x00;
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_repeat_refresh() {
+    Serialization::Serializer sender;
+    sender.begin(Encoding::SuppressRepeats);
+    Serialization::RawData input = {1, 2, 3, 4};
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    for (int n = 0; n < 127; ++n) {
+        sink.size = 0;
+        TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+        TEST_ASSERT_EQUAL(1, sink.size);
+    }
+    // counter exhausted, full frame again
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL(1 + Serialization::detail_::k_frameSize, sink.size);
+}
+
+void test_adaptive_picks_delta() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::Adaptive);
+    receiver.begin(Encoding::Adaptive);
+    Serialization::RawData input = {100, 200, 300, 400}, output;
+
+    // first frame is absolute
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL_HEX8(0x00, sink.data[0]);
+    TEST_ASSERT_EQUAL(Serialization::Serializer::messageSize(sink.data[0], Encoding::Adaptive), sink.size);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+
+    // one small change: tag, mask, one varint and hash
+    input[2] += 1;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL_HEX8(0x40 | 2, sink.data[0]);
+    TEST_ASSERT_EQUAL(Serialization::Serializer::messageSize(sink.data[0], Encoding::Adaptive), sink.size);
+    TEST_ASSERT_TRUE(sink.size < 1 + Serialization::detail_::k_frameSize);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+
+    // large change of every element: bit packing is smaller
+    input = {1000, 0, 1000, 0};
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL_HEX8(0x00, sink.data[0]);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+
+    // delta after a bit-packed frame uses it as reference
+    input[0] = 999;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_EQUAL_HEX8(0x40 | 2, sink.data[0]);
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_adaptive_stream() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::Adaptive);
+    receiver.begin(Encoding::Adaptive);
+    Serialization::RawData input = {500, 500, 500, 500}, output;
+    size_t total = 0, deltas = 0;
+    for (int n = 0; n < 200; ++n) {
+        for (auto &value : input)
+            value = static_cast<uint16_t>((value + rand() % 5 + 998) % 1001);
+        if (n % 7 == 0)
+            input[1] = static_cast<uint16_t>(rand() % 1001);
+        Sink sink;
+        TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+        TEST_ASSERT_EQUAL(Serialization::Serializer::messageSize(sink.data[0], Encoding::Adaptive), sink.size);
+        TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+        total += sink.size;
+        deltas += Serialization::detail_::Tag::isDelta(sink.data[0]);
+    }
+    // periodic absolute frames keep the receiver recoverable
+    TEST_ASSERT_TRUE(deltas > 0 && deltas < 200);
+    TEST_ASSERT_TRUE(total < 200 * (1 + Serialization::detail_::k_frameSize));
+}
+
+void test_adaptive_damaged_delta() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::Adaptive);
+    receiver.begin(Encoding::Adaptive);
+    Serialization::RawData input = {10, 20, 30, 40}, output;
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+
+    input[3] = 41;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(Serialization::detail_::Tag::isDelta(sink.data[0]));
+    // truncated and damaged messages are rejected
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size - 1, &output));
+    sink.data[2] ^= 0x01;
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+    // the reference is gone with them, until the next absolute frame
+    sink.data[2] ^= 0x01;
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+    input = {1000, 0, 1000, 0};
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_FALSE(Serialization::detail_::Tag::isDelta(sink.data[0]));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_adaptive_lost_delta() {
+    Serialization::Serializer sender, receiver;
+    sender.begin(Encoding::Adaptive);
+    receiver.begin(Encoding::Adaptive);
+    Serialization::RawData input = {10, 20, 30, 40}, output;
+    Sink sink;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+
+    // delta lost on the line
+    input[3] = 50;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(Serialization::detail_::Tag::isDelta(sink.data[0]));
+
+    // the next one is against a reference the receiver does not have
+    input[3] = 51;
+    sink.size = 0;
+    TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+    TEST_ASSERT_TRUE(Serialization::detail_::Tag::isDelta(sink.data[0]));
+    TEST_ASSERT_FALSE(receiver.deserialize(sink.data, sink.size, &output));
+
+    // deltas stay rejected until the periodic absolute frame
+    bool recovered = false;
+    for (int n = 0; n < 16 && !recovered; ++n) {
+        ++input[0];
+        sink.size = 0;
+        TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+        recovered = receiver.deserialize(sink.data, sink.size, &output);
+        TEST_ASSERT_EQUAL(!Serialization::detail_::Tag::isDelta(sink.data[0]), recovered);
+    }
+    TEST_ASSERT_TRUE(recovered);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+}
+
+void test_wide_hash() {
+    using Wide = Serialization::SerializerTpl<Serialization::detail_::Packing::viaBitReader, Serialization::detail_::Hash::Crc32Software>;
+    static_assert(Wide::k_frameSize == sizeof(Serialization::detail_::PackedData) + sizeof(uint32_t), "CRC-32 is sent in full");
+    Wide sender, receiver;
+    sender.begin(Wide::Encoding::Adaptive);
+    receiver.begin(Wide::Encoding::Adaptive);
+    Serialization::RawData input = {1, 2, 3, 4}, output;
+    for (size_t n = 0; n < input.size(); ++n) {
+        ++input[n];
+        Sink sink;
+        TEST_ASSERT_TRUE(sender.serialize(input, &sink));
+        TEST_ASSERT_EQUAL(Wide::messageSize(sink.data[0], Wide::Encoding::Adaptive), sink.size);
+        // every byte of the hash is checked, on a copy: a rejected delta drops the reference
+        Wide damaged = receiver;
+        sink.data[sink.size - 1] ^= 0x80;
+        TEST_ASSERT_FALSE(damaged.deserialize(sink.data, sink.size, &output));
+        sink.data[sink.size - 1] ^= 0x80;
+        TEST_ASSERT_TRUE(receiver.deserialize(sink.data, sink.size, &output));
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), output.data(), input.size());
+    }
+}
+
+// Stream taking a list of segments at once
+struct VectorSink : Sink {
+    size_t calls = 0;
+    size_t writev(const Tool::Segment *segments, size_t count) {
+        ++calls;
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i)
+            total += write(static_cast<const uint8_t *>(segments[i].data), segments[i].size);
+        return total;
+    }
+};
+
+void test_vectored_write() {
+    Serialization::Serializer serializer;
+    serializer.begin(Encoding::SuppressRepeats);
+    const Serialization::RawData input = {1, 2, 3, 4};
+    Sink plain;
+    VectorSink vectored;
+    TEST_ASSERT_TRUE(serializer.serialize(input, &plain));
+    serializer.begin(Encoding::SuppressRepeats);
+    TEST_ASSERT_TRUE(serializer.serialize(input, &vectored));
+    // Tag, packed data and hash in one call, same bytes
+    TEST_ASSERT_EQUAL(1, vectored.calls);
+    TEST_ASSERT_EQUAL(plain.size, vectored.size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plain.data, vectored.data, plain.size);
+}
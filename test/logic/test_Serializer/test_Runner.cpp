@@ -0,0 +1,112 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Logger.h"
+#include "Serialization/Serializer.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_batch_single_hash();
+extern void test_batch_per_frame_hash();
+extern void test_batch_per_frame_as_serialize();
+extern void test_batch_small_buffer();
+extern void test_deserialize_in_place();
+extern void test_repeat_token();
+extern void test_repeat_without_frame();
+extern void test_repeat_after_rejected_frame();
+extern void test_repeat_of_lost_frame();
+extern void test_rejected_write();
+extern void test_adaptive_rejected_write();
+extern void test_tag_is_hashed();
+extern void test_repeat_refresh();
+extern void test_adaptive_picks_delta();
+extern void test_adaptive_stream();
+extern void test_adaptive_damaged_delta();
+extern void test_adaptive_lost_delta();
+extern void test_wide_hash();
+extern void test_vectored_write();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/logic/test_Serializer/test.cpp");
+  run_test(test_batch_single_hash, "test_batch_single_hash", 49);
+  run_test(test_batch_per_frame_hash, "test_batch_per_frame_hash", 53);
+  run_test(test_batch_per_frame_as_serialize, "test_batch_per_frame_as_serialize", 57);
+  run_test(test_batch_small_buffer, "test_batch_small_buffer", 72);
+  run_test(test_deserialize_in_place, "test_deserialize_in_place", 82);
+  run_test(test_repeat_token, "test_repeat_token", 106);
+  run_test(test_repeat_without_frame, "test_repeat_without_frame", 139);
+  run_test(test_repeat_after_rejected_frame, "test_repeat_after_rejected_frame", 147);
+  run_test(test_repeat_of_lost_frame, "test_repeat_of_lost_frame", 168);
+  run_test(test_rejected_write, "test_rejected_write", 197);
+  run_test(test_adaptive_rejected_write, "test_adaptive_rejected_write", 217);
+  run_test(test_tag_is_hashed, "test_tag_is_hashed", 238);
+  run_test(test_repeat_refresh, "test_repeat_refresh", 261);
+  run_test(test_adaptive_picks_delta, "test_adaptive_picks_delta", 278);
+  run_test(test_adaptive_stream, "test_adaptive_stream", 319);
+  run_test(test_adaptive_damaged_delta, "test_adaptive_damaged_delta", 343);
+  run_test(test_adaptive_lost_delta, "test_adaptive_lost_delta", 371);
+  run_test(test_wide_hash, "test_wide_hash", 406);
+  run_test(test_vectored_write, "test_vectored_write", 440);
+
+  return UnityEnd();
+}
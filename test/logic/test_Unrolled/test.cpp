@@ -0,0 +1,105 @@
+// test\logic\test_Unrolled\test.cpp - unrolled packer for user and custom configs
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include "Serialization/Packing/Batch.h"
+#include "Serialization/Packing/Unrolled.h"
+#include "Serialization/Packing/viaBitReader.h"
+
+// Reference: bit by bit, LSB first
+template<typename Policy, typename Input, size_t N>
+void referencePack(Input const& input, std::array<uint8_t, N> *buffer) {
+    buffer->fill(0);
+    size_t bit = 0;
+    for (size_t field = 0; field < input.size(); ++field) {
+        const auto normalized = Policy::normalize(field, input[field]);
+        for (size_t i = 0; i < Policy::getBitCount(field); ++i, ++bit)
+            (*buffer)[bit / 8] |= ((normalized >> i) & 1) << (bit % 8);
+    }
+}
+
+template<typename Policy>
+void roundtrip() {
+    using Packer = Serialization::detail_::Packing::UnrolledTpl<Policy>;
+    typename Packer::Input input, unpacked;
+    std::array<uint8_t, Policy::packedSize()> expected, packed;
+    for (int n = 0; n < 100; ++n) {
+        for (size_t i = 0; i < input.size(); ++i)
+            input[i] = static_cast<typename Policy::InputType>(Policy::denormalize(i, rand()));
+        referencePack<Policy>(input, &expected);
+        Packer::pack(input, &packed);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), packed.data(), packed.size());
+        Packer::unpack(packed, &unpacked);
+        for (size_t i = 0; i < input.size(); ++i)
+            TEST_ASSERT_EQUAL(Policy::denormalize(i, Policy::normalize(i, input[i])), unpacked[i]);
+    }
+}
+
+void test_same_as_viaBitReader() {
+    Serialization::RawData input = {0, 999, 500, 42};
+    Serialization::detail_::PackedData expected, packed;
+    Serialization::detail_::Packing::viaBitReader::pack(input, &expected);
+    Serialization::detail_::Packing::Unrolled::pack(input, &packed);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), packed.data(), sizeof(packed));
+
+    Serialization::RawData unpacked;
+    Serialization::detail_::Packing::Unrolled::unpack(packed, &unpacked);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), unpacked.data(), input.size());
+}
+
+void test_unpack_from_view() {
+    Serialization::RawData input = {7, 1000, 0, 513}, unpacked;
+    Serialization::detail_::PackedData packed;
+    Serialization::detail_::Packing::Unrolled::pack(input, &packed);
+    // Packed bytes inside a received message, not at the start of an array
+    uint8_t message[1 + sizeof(packed)] = {0xA5};
+    std::copy(packed.begin(), packed.end(), message + 1);
+    Serialization::detail_::Packing::Unrolled::unpack(Serialization::detail_::PackedView(message + 1), &unpacked);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(input.data(), unpacked.data(), input.size());
+    // Serializer and Batch unpack in place with it
+    TEST_ASSERT_TRUE(Serialization::detail_::Packing::detail_::HasView<Serialization::detail_::Packing::Unrolled>::value);
+}
+
+void test_user_config() {
+    roundtrip<Tool::CompileTimeConfigure>();
+}
+
+void test_narrow_elements() {
+    roundtrip<Tool::CompileTimeConfigureTpl<uint8_t, Tool::UniformSchema<11, 0, 5>>>();
+}
+
+void test_wide_elements() {
+    roundtrip<Tool::CompileTimeConfigureTpl<uint32_t, Tool::UniformSchema<5, 0, 100000>>>();
+}
+
+void test_single_element() {
+    roundtrip<Tool::CompileTimeConfigureTpl<uint16_t, Tool::UniformSchema<1, 0, 255>>>();
+}
+
+void test_shifted_range() {
+    roundtrip<Tool::CompileTimeConfigureTpl<uint16_t, Tool::UniformSchema<6, 1000, 1063>>>();
+}
+
+// hours, minutes, seconds and a timer
+using Clock = Tool::CompileTimeConfigureTpl<uint16_t
+    , Tool::Schema<Tool::Field<0, 23>, Tool::Field<0, 59>, Tool::Field<0, 59>, Tool::Field<0, 1000>>>;
+
+void test_heterogeneous_schema() {
+    static_assert(!Clock::isUniform());
+    static_assert(Clock::getBitCount(0) == 5 && Clock::getBitCount(1) == 6 && Clock::getBitCount(3) == 10);
+    // 27 bits instead of 40
+    static_assert(Clock::packedSize() == 4);
+    roundtrip<Clock>();
+}
+
+void test_heterogeneous_clamping() {
+    using Packer = Serialization::detail_::Packing::UnrolledTpl<Clock>;
+    Packer::Input input = {24, 60, 59, 2000}, unpacked;
+    std::array<uint8_t, Clock::packedSize()> packed;
+    Packer::pack(input, &packed);
+    Packer::unpack(packed, &unpacked);
+    TEST_ASSERT_EQUAL_UINT16(23, unpacked[0]);
+    TEST_ASSERT_EQUAL_UINT16(59, unpacked[1]);
+    TEST_ASSERT_EQUAL_UINT16(59, unpacked[2]);
+    TEST_ASSERT_EQUAL_UINT16(1000, unpacked[3]);
+}
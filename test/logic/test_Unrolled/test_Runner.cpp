@@ -0,0 +1,93 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Serialization/Packing/Batch.h"
+#include "Serialization/Packing/Unrolled.h"
+#include "Serialization/Packing/viaBitReader.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_same_as_viaBitReader();
+extern void test_unpack_from_view();
+extern void test_user_config();
+extern void test_narrow_elements();
+extern void test_wide_elements();
+extern void test_single_element();
+extern void test_shifted_range();
+extern void test_heterogeneous_schema();
+extern void test_heterogeneous_clamping();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/logic/test_Unrolled/test.cpp");
+  run_test(test_same_as_viaBitReader, "test_same_as_viaBitReader", 38);
+  run_test(test_unpack_from_view, "test_unpack_from_view", 50);
+  run_test(test_user_config, "test_user_config", 63);
+  run_test(test_narrow_elements, "test_narrow_elements", 67);
+  run_test(test_wide_elements, "test_wide_elements", 71);
+  run_test(test_single_element, "test_single_element", 75);
+  run_test(test_shifted_range, "test_shifted_range", 79);
+  run_test(test_heterogeneous_schema, "test_heterogeneous_schema", 87);
+  run_test(test_heterogeneous_clamping, "test_heterogeneous_clamping", 95);
+
+  return UnityEnd();
+}
@@ -0,0 +1,48 @@
+// test/native/Model/Bus.h - address space of the host register models
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <map>
+
+/**
+ * Host models of the Device::Hal policies, same static interface as the target ones.
+ * DMA of a model moves data through the Bus: mapped addresses are registers of other models,
+ * any other address is plain host memory.
+ */
+namespace Model {
+struct Bus {
+    struct Port {
+        void (*write)(uint32_t value) = nullptr;
+        uint32_t (*read)() = nullptr;
+    };
+
+    static void map(uintptr_t address, Port port) {
+        ports( )[ address ] = port;
+    }
+    static void clear() {
+        ports( ).clear( );
+    }
+
+    static void write(uintptr_t address, uint32_t value, size_t size) {
+        auto it = ports( ).find( address );
+        if ( it != ports( ).end( ) && it ->second.write )
+            return it ->second.write( value );
+        memcpy( reinterpret_cast< void *>( address ), &value, size );
+    }
+    static uint32_t read(uintptr_t address, size_t size) {
+        auto it = ports( ).find( address );
+        if ( it != ports( ).end( ) && it ->second.read )
+            return it ->second.read( );
+        uint32_t value = 0;
+        memcpy( &value, reinterpret_cast< const void *>( address ), size );
+        return value;
+    }
+
+private:
+    static std::map< uintptr_t, Port > &ports() {
+        static std::map< uintptr_t, Port > value;
+        return value;
+    }
+};
+} // namespace Model
@@ -0,0 +1,28 @@
+// test/native/Model/Clock.h - host model of time: every sleep lasts one millisecond
+#pragma once
+#include <cstdint>
+
+namespace Model {
+struct Clock {
+    static inline uint32_t s_now = 0;
+    static inline uint32_t s_idles = 0;
+    /// Interrupts that happen during the sleep, e.g. bytes arriving
+    static inline void (*s_onIdle)() = nullptr;
+
+    static uint32_t millis() {
+        return s_now;
+    }
+    static void idle() {
+        ++s_idles;
+        ++s_now;
+        if ( s_onIdle )
+            s_onIdle( );
+    }
+
+    /// Model to the reset state
+    static void clear() {
+        s_now = s_idles = 0;
+        s_onIdle = nullptr;
+    }
+};
+} // namespace Model
@@ -0,0 +1,48 @@
+// test/native/Model/Crc.h - host model of the STM32 CRC unit
+#pragma once
+#include "Bus.h"
+
+namespace Model {
+/// CRC-32/MPEG-2 over 32-bit words: poly 0x04C11DB7, init 0xFFFFFFFF, MSB first, no final xor
+struct Crc {
+    static inline uint32_t s_dr = 0xFFFFFFFF;
+    static inline size_t s_resets = 0;
+    static inline size_t s_words = 0;
+
+    static void begin() {
+        Bus::map( dataAddress( ), { &onWrite, &read } );
+    }
+    static void reset() {
+        s_dr = 0xFFFFFFFF;
+        ++s_resets;
+    }
+    static uint32_t write(uint32_t word) {
+        uint32_t crc = s_dr ^ word;
+        for ( int i = 0; i < 32; ++i )
+            crc = ( crc & 0x80000000 ) ?( crc << 1 ) ^ 0x04C11DB7 :crc << 1;
+        ++s_words;
+        return s_dr = crc;
+    }
+    static uint32_t write(const uint32_t *words, size_t count) {
+        for ( size_t i = 0; i < count; ++i )
+            write( words[ i ] );
+        return s_dr;
+    }
+    static uint32_t read() {
+        return s_dr;
+    }
+    static uintptr_t dataAddress() {
+        return reinterpret_cast< uintptr_t >( &s_dr );
+    }
+
+    static void onWrite(uint32_t word) {
+        write( word );
+    }
+
+    /// Model to the power-on state
+    static void clear() {
+        s_dr = 0xFFFFFFFF;
+        s_resets = s_words = 0;
+    }
+};
+} // namespace Model
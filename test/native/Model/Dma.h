@@ -0,0 +1,119 @@
+// test/native/Model/Dma.h - host model of a DMA1 channel
+#pragma once
+#include "Bus.h"
+
+namespace Model {
+/**
+ * Channel registers as plain state. Nothing moves by itself: the test calls transfer()
+ * to let the "hardware" run and invokes the driver interrupt handler when it returns true.
+ */
+template<uint8_t Channel>
+struct Dma {
+    static inline uintptr_t s_from = 0, s_to = 0;
+    static inline bool s_fromIncrement = false, s_toIncrement = false;
+    static inline size_t s_unit = 1, s_count = 0, s_remaining = 0;
+    static inline bool s_enabled = false, s_circular = false, s_mem2mem = false;
+    static inline bool s_half = false, s_complete = false, s_error = false;
+    static inline bool s_halfIrq = false;
+    /// Interrupt raised by software
+    static inline bool s_pending = false;
+    static inline bool s_masked = false;
+    static inline size_t s_starts = 0;
+    static inline uint8_t s_priority = 0;
+
+    static void begin(uint8_t priority) {
+        s_priority = priority;
+    }
+    static void startWordsToRegister(const void *source, uintptr_t destination, size_t count) {
+        configure( reinterpret_cast< uintptr_t >( source ), true, destination, false, 4, count, false );
+        s_mem2mem = true;
+    }
+    static void startToPeripheral(const void *source, uintptr_t peripheral, size_t count) {
+        configure( reinterpret_cast< uintptr_t >( source ), true, peripheral, false, 1, count, false );
+    }
+    static void startFromPeripheral(uintptr_t peripheral, volatile void *destination, size_t count, bool circular) {
+        configure( peripheral, false, reinterpret_cast< uintptr_t >( destination ), true, 1, count, circular );
+    }
+    static void enableHalfInterrupt() {
+        s_halfIrq = true;
+    }
+    static void maskIrq() {
+        s_masked = true;
+    }
+    static void unmaskIrq() {
+        s_masked = false;
+    }
+    static void pend() {
+        s_pending = true;
+    }
+    static void stop() {
+        s_enabled = false;
+    }
+    static size_t remaining() {
+        return s_remaining;
+    }
+    static bool isHalf() { return s_half; }
+    static bool isComplete() { return s_complete; }
+    static bool isError() { return s_error; }
+    static void clearHalf() { s_half = false; }
+    static void clearComplete() { s_complete = false; }
+    static void clearError() { s_error = false; }
+
+    /**
+     * Moves up to `units` items, stops at the first event
+     * @return An enabled interrupt is pending
+     */
+    static bool transfer(size_t units) {
+        for ( size_t i = 0; i < units && s_enabled; ++i ) {
+            const size_t index = s_count - s_remaining;
+            const uint32_t value = Bus::read( s_from + ( s_fromIncrement ?index * s_unit :0 ), s_unit );
+            Bus::write( s_to + ( s_toIncrement ?index * s_unit :0 ), value, s_unit );
+            if ( --s_remaining == s_count / 2 && s_halfIrq ) {
+                s_half = true;
+                return true;
+            }
+            if ( !s_remaining ) {
+                s_complete = true;
+                if ( s_circular )
+                    s_remaining = s_count;
+                else
+                    s_enabled = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Bus error: the channel is disabled by the hardware
+    static void fault() {
+        s_error = true;
+        s_enabled = false;
+    }
+
+    /// Model to the reset state
+    static void clear() {
+        s_from = s_to = 0;
+        s_count = s_remaining = s_starts = 0;
+        s_enabled = s_circular = s_mem2mem = s_half = s_complete = s_error = s_halfIrq = s_pending = s_masked = false;
+    }
+
+    /// Takes the software-raised interrupt
+    static bool pending() {
+        const bool value = s_pending;
+        s_pending = false;
+        return value;
+    }
+
+private:
+    static void configure(uintptr_t from, bool fromIncrement, uintptr_t to, bool toIncrement, size_t unit, size_t count, bool circular) {
+        // dma_channel_reset() and the flags cleared on start
+        s_from = from, s_fromIncrement = fromIncrement;
+        s_to = to, s_toIncrement = toIncrement;
+        s_unit = unit, s_count = s_remaining = count;
+        s_circular = circular, s_mem2mem = false, s_halfIrq = false;
+        s_half = s_complete = s_error = false;
+        s_enabled = true;
+        ++s_starts;
+    }
+};
+} // namespace Model
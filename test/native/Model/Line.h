@@ -0,0 +1,54 @@
+// test/native/Model/Line.h - bytes arriving on the USART line into a driver, fixture of the UART tests
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Bus.h"
+#include "Clock.h"
+#include "Usart.h"
+
+namespace Model {
+/**
+ * Receive side of a driver under test as the hardware runs it: every byte goes onto the line,
+ * the RX DMA model moves it and the driver interrupt handlers are invoked when the models raise them.
+ * Bytes count up from zero after clear(), so a test can tell which one it got.
+ * @tparam Driver Driver with static rxIsr() and usartIsr(), e.g. HardwareUARTTpl
+ * @tparam RxDma DMA model of the RX channel
+ * @tparam TxDma DMA model of the TX channel
+ */
+template<typename Driver, typename RxDma, typename TxDma>
+struct Line {
+    /// Value of the next byte on the line
+    static inline uint8_t s_next = 0;
+
+    /// Bytes arrive on the line, DMA moves them and raises its interrupts
+    static void receive(size_t size) {
+        for ( size_t i = 0; i < size; ++i ) {
+            Usart::s_line.push_back( s_next++ );
+            if ( RxDma::transfer( 1 ) )
+                Driver::rxIsr( );
+        }
+    }
+
+    /// Line goes idle after the message
+    static void idle() {
+        Usart::s_idle = true;
+        Driver::usartIsr( );
+    }
+
+    /// A whole message: its bytes, then the idle line
+    static void message(size_t size) {
+        receive( size );
+        idle( );
+    }
+
+    /// All models of the UART path to the reset state, before the driver begin()
+    static void clear() {
+        Bus::clear( );
+        Usart::clear( );
+        Clock::clear( );
+        RxDma::clear( );
+        TxDma::clear( );
+        s_next = 0;
+    }
+};
+} // namespace Model
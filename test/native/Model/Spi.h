@@ -0,0 +1,67 @@
+// test/native/Model/Spi.h - host model of the SPI master with a slave on the other side
+#pragma once
+#include <deque>
+#include <vector>
+#include "Bus.h"
+
+namespace Model {
+/// Data register on the Bus: each DMA write shifts a byte out and one from the slave in
+struct Spi {
+    static inline uint32_t s_dr = 0;
+    static inline bool s_begun = false, s_selected = false;
+    static inline size_t s_discards = 0;
+    /// Bytes sent while selected, in order
+    static inline std::vector< uint8_t > s_mosi;
+    /// Answers of the slave, 0xFF once it has nothing to say
+    static inline std::deque< uint8_t > s_miso;
+    /// Received bytes waiting for RX DMA
+    static inline std::deque< uint8_t > s_received;
+
+    static void begin() {
+        s_begun = true;
+        Bus::map( dataAddress( ), { &onWrite, &onRead } );
+    }
+    static void select() {
+        s_selected = true;
+    }
+    static void deselect() {
+        s_selected = false;
+    }
+    static void discard() {
+        ++s_discards;
+        s_received.clear( );
+    }
+    static uintptr_t dataAddress() {
+        return reinterpret_cast< uintptr_t >( &s_dr );
+    }
+
+    static void onWrite(uint32_t value) {
+        if ( !s_selected )
+            return;
+        s_mosi.push_back( static_cast< uint8_t >( value ) );
+        uint8_t answer = 0xFF;
+        if ( !s_miso.empty( ) ) {
+            answer = s_miso.front( );
+            s_miso.pop_front( );
+        }
+        s_received.push_back( answer );
+    }
+    static uint32_t onRead() {
+        if ( s_received.empty( ) )
+            return 0;
+        const uint8_t value = s_received.front( );
+        s_received.pop_front( );
+        return value;
+    }
+
+    /// Model to the reset state
+    static void clear() {
+        s_dr = 0;
+        s_begun = s_selected = false;
+        s_discards = 0;
+        s_mosi.clear( );
+        s_miso.clear( );
+        s_received.clear( );
+    }
+};
+} // namespace Model
@@ -0,0 +1,54 @@
+// test/native/Model/Usart.h - host model of the USART: a wire out and a line in
+#pragma once
+#include <deque>
+#include <vector>
+#include "Bus.h"
+
+namespace Model {
+/// Data register on the Bus: DMA writes go to the wire, DMA reads take the next byte of the line
+struct Usart {
+    static inline uint32_t s_dr = 0;
+    static inline uint32_t s_baud = 0;
+    /// Bytes sent, in order
+    static inline std::vector< uint8_t > s_wire;
+    /// Bytes to be received
+    static inline std::deque< uint8_t > s_line;
+    static inline bool s_idle = false, s_idleIrq = false;
+
+    static void begin(uint32_t baud) {
+        s_baud = baud;
+        Bus::map( dataAddress( ), { &onWrite, &onRead } );
+    }
+    static void enableIdleInterrupt(uint8_t) {
+        s_idleIrq = true;
+    }
+    static bool isIdle() {
+        return s_idle;
+    }
+    static void clearIdle() {
+        s_idle = false;
+    }
+    static uintptr_t dataAddress() {
+        return reinterpret_cast< uintptr_t >( &s_dr );
+    }
+
+    static void onWrite(uint32_t value) {
+        s_wire.push_back( static_cast< uint8_t >( value ) );
+    }
+    static uint32_t onRead() {
+        if ( s_line.empty( ) )
+            return 0;
+        const uint8_t value = s_line.front( );
+        s_line.pop_front( );
+        return value;
+    }
+
+    /// Model to the reset state
+    static void clear() {
+        s_dr = s_baud = 0;
+        s_idle = s_idleIrq = false;
+        s_wire.clear( );
+        s_line.clear( );
+    }
+};
+} // namespace Model
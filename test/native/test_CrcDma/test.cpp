@@ -0,0 +1,129 @@
+// test/native/test_CrcDma/test.cpp - sequencing of the DMA-fed CRC against host register models
+#include <unity.h>
+#include "../Model/Crc.h"
+#include "../Model/Dma.h"
+#include "Serialization/Hash/CrcDma.h"
+
+using Dma = Model::Dma< 1 >;
+using Crc = Model::Crc;
+using Driver = Serialization::detail_::Hash::CrcDmaTpl< Dma, Crc >;
+using Status = Driver::Status;
+
+alignas( 4 ) static uint8_t g_data[ 1023 ];
+static Driver g_driver;
+
+void setUp() {
+    Model::Bus::clear( );
+    Dma::clear( );
+    Crc::clear( );
+    for ( size_t i = 0; i < sizeof( g_data ); ++i )
+        g_data[ i ] = static_cast< uint8_t >( i * 7 + 3 );
+    g_driver.begin( );
+}
+void tearDown() {}
+
+// Same as CrcHardware::calculate(): words by the CPU, the tail padded with zeros
+static uint32_t reference(const uint8_t *data, size_t size) {
+    const uint32_t saved = Crc::s_dr;
+    Crc::s_dr = 0xFFFFFFFF;
+    for ( size_t i = 0; i < size; i += 4 ) {
+        uint32_t word = 0;
+        memcpy( &word, data + i, ( size - i < 4 ) ?size - i :4 );
+        Crc::write( word );
+    }
+    const uint32_t crc = Crc::s_dr;
+    Crc::s_dr = saved;
+    return crc;
+}
+
+// Lets the model run and delivers its interrupts
+static void run(size_t units) {
+    if ( Dma::transfer( units ) )
+        Driver::isr( );
+}
+
+void test_dma_matches_cpu() {
+    const uint32_t expected = reference( g_data, sizeof( g_data ) );
+    TEST_ASSERT_TRUE( g_driver.start( g_data, sizeof( g_data ) ) );
+    TEST_ASSERT_EQUAL( 1, Crc::s_resets );
+    TEST_ASSERT_TRUE( Dma::s_mem2mem );
+    TEST_ASSERT_EQUAL( Crc::dataAddress( ), Dma::s_to );
+    TEST_ASSERT_EQUAL( sizeof( g_data ) / 4, Dma::s_count );
+
+    uint32_t crc = 0;
+    run( 100 );
+    TEST_ASSERT_TRUE( g_driver.isBusy( ) );
+    TEST_ASSERT_EQUAL( Status::Busy, g_driver.poll( &crc ) );
+    run( 1000 );
+    TEST_ASSERT_FALSE( g_driver.isBusy( ) );
+    TEST_ASSERT_FALSE( Dma::s_complete );
+    TEST_ASSERT_EQUAL( Status::Done, g_driver.poll( &crc ) );
+    TEST_ASSERT_EQUAL_HEX32( expected, crc );
+}
+
+void test_callback_once_and_busy() {
+    struct Result { uint32_t crc; int calls; } result = { 0, 0 };
+    auto callback = [](uint32_t crc, void *context) {
+            auto *result = static_cast< Result *>( context );
+            result ->crc = crc;
+            ++result ->calls;
+        };
+    TEST_ASSERT_TRUE( g_driver.start( g_data, 512, callback, &result ) );
+    TEST_ASSERT_FALSE( g_driver.start( g_data, 512 ) );
+    TEST_ASSERT_EQUAL( 1, Dma::s_starts );
+    run( 128 );
+    TEST_ASSERT_EQUAL( 1, result.calls );
+    TEST_ASSERT_EQUAL_HEX32( reference( g_data, 512 ), result.crc );
+    // Spurious interrupt after the completion
+    Driver::isr( );
+    TEST_ASSERT_EQUAL( 1, result.calls );
+}
+
+void test_unaligned_by_cpu() {
+    struct Result { uint32_t crc; int calls; } result = { 0, 0 };
+    auto callback = [](uint32_t crc, void *context) {
+            auto *result = static_cast< Result *>( context );
+            result ->crc = crc;
+            ++result ->calls;
+        };
+    uint32_t crc = 0;
+    const uint32_t expected = reference( g_data + 1, 99 );
+    TEST_ASSERT_TRUE( g_driver.start( g_data + 1, 99, callback, &result ) );
+    TEST_ASSERT_EQUAL( 0, Dma::s_starts );
+    // Words hashed inside start(), the callback waits for the interrupt raised by software
+    TEST_ASSERT_EQUAL( 0, result.calls );
+    TEST_ASSERT_EQUAL( Status::Busy, g_driver.poll( &crc ) );
+    TEST_ASSERT_TRUE( Dma::pending( ) );
+    // The interrupt only feeds the tail: the data may change from here on
+    const size_t words = Crc::s_words;
+    memset( g_data, 0, sizeof( g_data ) );
+    Driver::isr( );
+    TEST_ASSERT_EQUAL( words + 1, Crc::s_words );
+    TEST_ASSERT_EQUAL( 1, result.calls );
+    TEST_ASSERT_EQUAL( Status::Done, g_driver.poll( &crc ) );
+    TEST_ASSERT_EQUAL_HEX32( expected, crc );
+    TEST_ASSERT_EQUAL_HEX32( crc, result.crc );
+    setUp( );
+
+    TEST_ASSERT_TRUE( g_driver.start( g_data, 3 ) );
+    TEST_ASSERT_EQUAL( 0, Dma::s_starts );
+    TEST_ASSERT_TRUE( Dma::pending( ) );
+    Driver::isr( );
+    TEST_ASSERT_EQUAL( Status::Done, g_driver.poll( &crc ) );
+    TEST_ASSERT_EQUAL_HEX32( reference( g_data, 3 ), crc );
+}
+
+void test_transfer_error() {
+    uint32_t crc = 0;
+    TEST_ASSERT_TRUE( g_driver.start( g_data, 256 ) );
+    run( 10 );
+    Dma::fault( );
+    Driver::isr( );
+    TEST_ASSERT_EQUAL( Status::Failed, g_driver.poll( &crc ) );
+    TEST_ASSERT_FALSE( Dma::s_error );
+    // Usable again
+    TEST_ASSERT_TRUE( g_driver.start( g_data, 256 ) );
+    run( 64 );
+    TEST_ASSERT_EQUAL( Status::Done, g_driver.poll( &crc ) );
+    TEST_ASSERT_EQUAL_HEX32( reference( g_data, 256 ), crc );
+}
@@ -0,0 +1,104 @@
+// test/native/test_SpiDma/test.cpp - DMA sequencing of SPI transfers against host register models
+#include <unity.h>
+#include "../Model/Dma.h"
+#include "../Model/Spi.h"
+#include "Device/SpiDma.h"
+
+using RxDma = Model::Dma< 4 >;
+using TxDma = Model::Dma< 5 >;
+using Spi = Device::SpiDmaTpl< Model::Spi, RxDma, TxDma >;
+using Status = Spi::Status;
+
+static Spi g_spi;
+
+void setUp() {
+    Model::Bus::clear( );
+    Model::Spi::clear( );
+    RxDma::clear( );
+    TxDma::clear( );
+    g_spi.begin( );
+}
+void tearDown() {}
+
+// SPI clocks bytes: TX DMA feeds the data register, RX DMA takes what came back
+static void clock(size_t bytes) {
+    for ( size_t i = 0; i < bytes; ++i ) {
+        if ( TxDma::transfer( 1 ) )
+            Spi::isr( );
+        if ( !Model::Spi::s_received.empty( ) && RxDma::transfer( 1 ) )
+            Spi::isr( );
+    }
+}
+
+static void onDone(void *context) {
+    ++*static_cast< int *>( context );
+}
+
+void test_configured_once() {
+    TEST_ASSERT_TRUE( Model::Spi::s_begun );
+    TEST_ASSERT_EQUAL( RxDma::s_priority, TxDma::s_priority );
+    TEST_ASSERT_FALSE( g_spi.isBusy( ) );
+    TEST_ASSERT_TRUE( Status::Idle == g_spi.poll( ) );
+}
+
+void test_full_duplex_transfer() {
+    const uint8_t tx[ 6 ] = { 0x34, 0x12, 0x05, 0x00, 0x00, 0xA1 };
+    uint8_t rx[ 6 ] = { };
+    Model::Spi::s_miso = { 1, 2, 3, 4, 5, 6 };
+    int done = 0;
+    TEST_ASSERT_TRUE( g_spi.start( tx, rx, sizeof( tx ), &onDone, &done ) );
+    // Returns at once, both channels armed, the slave selected
+    TEST_ASSERT_TRUE( g_spi.isBusy( ) );
+    TEST_ASSERT_TRUE( Model::Spi::s_selected );
+    TEST_ASSERT_EQUAL( 1, Model::Spi::s_discards );
+    TEST_ASSERT_TRUE( RxDma::s_enabled && TxDma::s_enabled );
+    TEST_ASSERT_EQUAL( Model::Spi::dataAddress( ), RxDma::s_from );
+    TEST_ASSERT_EQUAL( Model::Spi::dataAddress( ), TxDma::s_to );
+    TEST_ASSERT_FALSE( RxDma::s_circular );
+    TEST_ASSERT_FALSE( g_spi.start( tx, rx, sizeof( tx ) ) );
+
+    clock( 5 );
+    TEST_ASSERT_TRUE( g_spi.isBusy( ) );
+    // TX completes first, the last byte is still being received
+    TEST_ASSERT_TRUE( TxDma::transfer( 1 ) );
+    Spi::isr( );
+    TEST_ASSERT_TRUE( g_spi.isBusy( ) );
+    TEST_ASSERT_TRUE( Model::Spi::s_selected );
+    TEST_ASSERT_TRUE( RxDma::transfer( 1 ) );
+    Spi::isr( );
+
+    TEST_ASSERT_TRUE( Status::Done == g_spi.poll( ) );
+    TEST_ASSERT_EQUAL( 1, done );
+    TEST_ASSERT_FALSE( Model::Spi::s_selected );
+    TEST_ASSERT_FALSE( TxDma::s_complete || RxDma::s_complete );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( tx, Model::Spi::s_mosi.data( ), sizeof( tx ) );
+    const uint8_t expected[ 6 ] = { 1, 2, 3, 4, 5, 6 };
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( expected, rx, sizeof( rx ) );
+}
+
+void test_back_to_back() {
+    uint8_t tx[ 4 ] = { 1, 2, 3, 4 }, rx[ 4 ];
+    for ( int n = 0; n < 3; ++n ) {
+        TEST_ASSERT_TRUE( g_spi.start( tx, rx, sizeof( tx ) ) );
+        clock( sizeof( tx ) );
+        TEST_ASSERT_TRUE( Status::Done == g_spi.poll( ) );
+    }
+    TEST_ASSERT_EQUAL( 3, RxDma::s_starts );
+    TEST_ASSERT_EQUAL( 12, Model::Spi::s_mosi.size( ) );
+    TEST_ASSERT_FALSE( g_spi.start( tx, rx, 0 ) );
+}
+
+void test_transfer_error() {
+    uint8_t tx[ 4 ] = { }, rx[ 4 ];
+    int done = 0;
+    TEST_ASSERT_TRUE( g_spi.start( tx, rx, sizeof( tx ), &onDone, &done ) );
+    clock( 2 );
+    TxDma::fault( );
+    Spi::isr( );
+    TEST_ASSERT_TRUE( Status::Failed == g_spi.poll( ) );
+    TEST_ASSERT_EQUAL( 0, done );
+    TEST_ASSERT_FALSE( RxDma::s_enabled || Model::Spi::s_selected );
+    // A stray vector afterwards does nothing
+    Spi::isr( );
+    TEST_ASSERT_TRUE( g_spi.start( tx, rx, sizeof( tx ) ) );
+}
@@ -0,0 +1,111 @@
+// test/native/test_SpscRing/test.cpp - ring buffer semantics and a two-thread stress test
+#include <unity.h>
+void setUp() {} void tearDown() {}
+
+#include <thread>
+#include "Tool/SpscRing.h"
+
+void test_push_pop_full_empty() {
+    Tool::SpscRing< int, 4 > ring;
+    TEST_ASSERT_TRUE( ring.empty( ) );
+    for ( int i = 0; i < 4; ++i )
+        TEST_ASSERT_TRUE( ring.push( i ) );
+    TEST_ASSERT_FALSE( ring.push( 4 ) );
+    TEST_ASSERT_EQUAL( 0, ring.free( ) );
+    int value = -1;
+    for ( int i = 0; i < 4; ++i ) {
+        TEST_ASSERT_TRUE( ring.pop( &value ) );
+        TEST_ASSERT_EQUAL( i, value );
+    }
+    TEST_ASSERT_FALSE( ring.pop( &value ) );
+}
+
+void test_write_all_or_nothing_and_wrap() {
+    Tool::SpscRing< uint8_t, 8 > ring;
+    const uint8_t data[ 8 ] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint8_t out[ 8 ] = { };
+    TEST_ASSERT_TRUE( ring.write( data, 6 ) );
+    TEST_ASSERT_FALSE( ring.write( data, 3 ) );
+    TEST_ASSERT_EQUAL( 6, ring.size( ) );
+    TEST_ASSERT_EQUAL( 5, ring.read( out, 5 ) );
+    // Across the end of the storage
+    TEST_ASSERT_TRUE( ring.write( data, 7 ) );
+    TEST_ASSERT_EQUAL( 8, ring.read( out, 8 ) );
+    TEST_ASSERT_EQUAL( 6, out[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( data, out + 1, 7 );
+}
+
+void test_readable_in_place() {
+    Tool::SpscRing< uint8_t, 8 > ring;
+    const uint8_t data[ 8 ] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const uint8_t *piece = nullptr;
+    ring.write( data, 6 );
+    ring.release( 6 );
+    ring.write( data, 5 );
+    // Up to the end of the storage, then from its start
+    TEST_ASSERT_EQUAL( 2, ring.readable( &piece ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( data, piece, 2 );
+    ring.release( 2 );
+    TEST_ASSERT_EQUAL( 3, ring.readable( &piece ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( data + 2, piece, 3 );
+    uint8_t out[ 3 ] = { };
+    TEST_ASSERT_EQUAL( 3, ring.peek( out, 8 ) );
+    TEST_ASSERT_EQUAL( 3, ring.size( ) );
+}
+
+void test_commit_by_hardware_overrun() {
+    Tool::SpscRing< uint8_t, 8 > ring;
+    // E.g. circular DMA writes the storage, an interrupt commits
+    ring.data( )[ 0 ] = 0xAA;
+    ring.commit( 1 );
+    TEST_ASSERT_EQUAL( 1, ring.size( ) );
+    ring.commit( 9 );
+    TEST_ASSERT_EQUAL( 10, ring.size( ) );
+    ring.drop( );
+    TEST_ASSERT_TRUE( ring.empty( ) );
+    TEST_ASSERT_EQUAL( 10, ring.tail( ) );
+}
+
+// Producer and consumer on their own threads, the consumer sees every value once and in order
+void test_stress_two_threads() {
+    static Tool::SpscRing< uint32_t, 64 > ring;
+    constexpr uint32_t k_count = 2000000;
+    std::thread producer( [] {
+            uint32_t next = 0, burst[ 7 ];
+            while ( next < k_count ) {
+                // Full, on a single core the consumer needs the time slice
+                if ( !ring.free( ) )
+                    std::this_thread::yield( );
+                if ( next % 3 ) {
+                    if ( ring.push( next ) )
+                        ++next;
+                    continue;
+                }
+                for ( uint32_t i = 0; i < 7; ++i )
+                    burst[ i ] = next + i;
+                if ( next + 7 <= k_count && ring.write( burst, 7 ) )
+                    next += 7;
+                else if ( ring.push( next ) )
+                    ++next;
+            }
+        } );
+    uint32_t expected = 0, errors = 0, buffer[ 16 ];
+    while ( expected < k_count ) {
+        if ( ring.empty( ) )
+            std::this_thread::yield( );
+        if ( expected & 1 ) {
+            const size_t count = ring.read( buffer, 16 );
+            for ( size_t i = 0; i < count; ++i )
+                errors += ( buffer[ i ] != expected++ );
+        } else {
+            const uint32_t *piece;
+            const size_t count = ring.readable( &piece );
+            for ( size_t i = 0; i < count; ++i )
+                errors += ( piece[ i ] != expected++ );
+            ring.release( count );
+        }
+    }
+    producer.join( );
+    TEST_ASSERT_EQUAL( 0, errors );
+    TEST_ASSERT_TRUE( ring.empty( ) );
+}
@@ -0,0 +1,83 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Tool/SpscRing.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_push_pop_full_empty();
+extern void test_write_all_or_nothing_and_wrap();
+extern void test_readable_in_place();
+extern void test_commit_by_hardware_overrun();
+extern void test_stress_two_threads();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/native/test_SpscRing/test.cpp");
+  run_test(test_push_pop_full_empty, "test_push_pop_full_empty", 8);
+  run_test(test_write_all_or_nothing_and_wrap, "test_write_all_or_nothing_and_wrap", 23);
+  run_test(test_readable_in_place, "test_readable_in_place", 38);
+  run_test(test_commit_by_hardware_overrun, "test_commit_by_hardware_overrun", 56);
+  run_test(test_stress_two_threads, "test_stress_two_threads", 70);
+
+  return UnityEnd();
+}
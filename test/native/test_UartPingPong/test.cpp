@@ -0,0 +1,89 @@
+// test/native/test_UartPingPong/test.cpp - double-buffered reception of HardwareUART against host register models
+#include <unity.h>
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Line.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+using RxDma = Model::Dma< 3 >;
+using TxDma = Model::Dma< 2 >;
+using Uart = Device::HardwareUARTTpl< Model::Usart, RxDma, TxDma, Model::Clock, Device::Uart::PingPongReceiver >;
+using Line = Model::Line< Uart, RxDma, TxDma >;
+constexpr size_t k_frame = sizeof( Uart::Buffer );
+
+static Uart g_uart;
+
+void setUp() {
+    Line::clear( );
+    g_uart.begin( 115200 );
+}
+void tearDown() {}
+
+void test_two_halves_one_transfer() {
+    TEST_ASSERT_TRUE( RxDma::s_circular );
+    TEST_ASSERT_TRUE( RxDma::s_halfIrq );
+    TEST_ASSERT_EQUAL( 2 * k_frame, RxDma::s_count );
+    TEST_ASSERT_NULL( g_uart.acquire( ) );
+}
+
+void test_ownership_alternates_without_copy() {
+    const uint8_t *previous = nullptr;
+    Line::receive( k_frame );
+    for ( uint8_t i = 0; i < 4; ++i ) {
+        const uint8_t *frame = g_uart.acquire( );
+        TEST_ASSERT_NOT_NULL( frame );
+        TEST_ASSERT_TRUE( frame != previous );
+        TEST_ASSERT_EQUAL_HEX8( i * k_frame, frame[ 0 ] );
+        // DMA fills the other buffer meanwhile
+        Line::receive( k_frame - 1 );
+        TEST_ASSERT_EQUAL_HEX8( i * k_frame, frame[ 0 ] );
+        TEST_ASSERT_TRUE( g_uart.release( ) );
+        TEST_ASSERT_NULL( g_uart.acquire( ) );
+        Line::receive( 1 );
+        previous = frame;
+    }
+    TEST_ASSERT_TRUE( g_uart.consume( [&](const uint8_t *frame, size_t size) {
+            return k_frame == size && frame != previous && static_cast< uint8_t >( 4 * k_frame ) == frame[ 0 ];
+        } ) );
+    TEST_ASSERT_EQUAL( 0, g_uart.overruns( ) );
+}
+
+void test_overrun_while_owned() {
+    Line::receive( k_frame );
+    TEST_ASSERT_NOT_NULL( g_uart.acquire( ) );
+    // Application is late: the other buffer completes, DMA wraps into the owned one
+    Line::receive( k_frame + 1 );
+    TEST_ASSERT_FALSE( g_uart.release( ) );
+    TEST_ASSERT_EQUAL( 1, g_uart.overruns( ) );
+    // The newest frame is still intact
+    const uint8_t *frame = g_uart.acquire( );
+    TEST_ASSERT_NOT_NULL( frame );
+    TEST_ASSERT_EQUAL_HEX8( k_frame, frame[ 0 ] );
+    TEST_ASSERT_TRUE( g_uart.release( ) );
+}
+
+void test_late_consumer_skips_overwritten() {
+    Line::receive( 3 * k_frame );
+    // Frames 0 and 1 are gone, 2 is the latest complete one
+    TEST_ASSERT_EQUAL( k_frame, g_uart.available( ) );
+    TEST_ASSERT_EQUAL( 2, g_uart.overruns( ) );
+    Uart::Buffer buffer = { };
+    TEST_ASSERT_EQUAL( k_frame, g_uart.readBytes( buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_HEX8( 2 * k_frame, buffer[ 0 ] );
+    TEST_ASSERT_EQUAL( 0, g_uart.available( ) );
+}
+
+void test_read_as_stream() {
+    uint8_t buffer[ 2 * k_frame ] = { };
+    TEST_ASSERT_EQUAL( 0, g_uart.read( buffer, sizeof( buffer ) ) );
+    Line::receive( k_frame + 1 );
+    // Whole frames only
+    TEST_ASSERT_EQUAL( 0, g_uart.read( buffer, k_frame - 1 ) );
+    TEST_ASSERT_EQUAL( k_frame, g_uart.read( buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_HEX8( 0, buffer[ 0 ] );
+    TEST_ASSERT_EQUAL( 0, g_uart.read( buffer, sizeof( buffer ) ) );
+    Line::receive( k_frame - 1 );
+    TEST_ASSERT_EQUAL( k_frame, g_uart.read( buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_HEX8( k_frame, buffer[ 0 ] );
+}
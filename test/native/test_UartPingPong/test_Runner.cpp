@@ -0,0 +1,86 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_two_halves_one_transfer();
+extern void test_ownership_alternates_without_copy();
+extern void test_overrun_while_owned();
+extern void test_late_consumer_skips_overwritten();
+extern void test_read_as_stream();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/native/test_UartPingPong/test.cpp");
+  run_test(test_two_halves_one_transfer, "test_two_halves_one_transfer", 35);
+  run_test(test_ownership_alternates_without_copy, "test_ownership_alternates_without_copy", 42);
+  run_test(test_overrun_while_owned, "test_overrun_while_owned", 64);
+  run_test(test_late_consumer_skips_overwritten, "test_late_consumer_skips_overwritten", 78);
+  run_test(test_read_as_stream, "test_read_as_stream", 89);
+
+  return UnityEnd();
+}
@@ -0,0 +1,124 @@
+// test/native/test_UartRx/test.cpp - RX byte ring of HardwareUART against host register models
+#include <unity.h>
+#include <vector>
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Line.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+using RxDma = Model::Dma< 3 >;
+using TxDma = Model::Dma< 2 >;
+using Uart = Device::HardwareUARTTpl< Model::Usart, RxDma, TxDma, Model::Clock >;
+constexpr size_t k_ring = Uart::k_RxBufferSize;
+using Line = Model::Line< Uart, RxDma, TxDma >;
+constexpr size_t k_frame = sizeof( Uart::Buffer );
+
+static Uart g_uart;
+
+void setUp() {
+    Line::clear( );
+    g_uart.begin( 115200 );
+}
+void tearDown() {}
+
+static void assertSequence(const uint8_t *data, size_t size, uint8_t first) {
+    for ( size_t i = 0; i < size; ++i )
+        TEST_ASSERT_EQUAL_HEX8( static_cast< uint8_t >( first + i ), data[ i ] );
+}
+
+void test_begin_setup() {
+    TEST_ASSERT_TRUE( RxDma::s_circular );
+    TEST_ASSERT_TRUE( RxDma::s_halfIrq );
+    TEST_ASSERT_TRUE( Model::Usart::s_idleIrq );
+    TEST_ASSERT_EQUAL( k_ring, RxDma::s_count );
+    TEST_ASSERT_EQUAL( 0, g_uart.available( ) );
+}
+
+void test_idle_publishes_short_message() {
+    Line::receive( 7 );
+    // Bytes are in the ring but not announced yet
+    TEST_ASSERT_EQUAL( 0, g_uart.available( ) );
+    Line::idle( );
+    TEST_ASSERT_EQUAL( 7, g_uart.available( ) );
+    uint8_t buffer[ 16 ];
+    TEST_ASSERT_EQUAL( 7, g_uart.read( buffer, sizeof( buffer ) ) );
+    assertSequence( buffer, 7, 0 );
+    TEST_ASSERT_EQUAL( 0, g_uart.read( buffer, sizeof( buffer ) ) );
+}
+
+void test_half_and_complete_without_idle() {
+    uint8_t buffer[ k_ring ];
+    Line::receive( k_ring / 2 );
+    TEST_ASSERT_EQUAL( k_ring / 2, g_uart.read( buffer, sizeof( buffer ) ) );
+    Line::receive( k_ring / 2 );
+    TEST_ASSERT_EQUAL( k_ring / 2, g_uart.available( ) );
+    // Partial read, the rest stays
+    TEST_ASSERT_EQUAL( 10, g_uart.read( buffer, 10 ) );
+    assertSequence( buffer, 10, k_ring / 2 );
+    TEST_ASSERT_EQUAL( k_ring / 2 - 10, g_uart.available( ) );
+}
+
+void test_message_across_ring_end() {
+    uint8_t buffer[ k_ring ];
+    Line::receive( k_ring - 5 );
+    Line::idle( );
+    TEST_ASSERT_EQUAL( k_ring - 5, g_uart.read( buffer, sizeof( buffer ) ) );
+    Line::receive( 20 );
+    Line::idle( );
+    TEST_ASSERT_EQUAL( 20, g_uart.read( buffer, sizeof( buffer ) ) );
+    assertSequence( buffer, 20, static_cast< uint8_t >( k_ring - 5 ) );
+}
+
+void test_consume_contiguous_and_wrapped() {
+    size_t calls = 0;
+    uint8_t first = 0;
+    auto check = [&](const uint8_t *frame, size_t size) {
+            TEST_ASSERT_EQUAL( k_frame, size );
+            assertSequence( frame, size, first );
+            ++calls;
+            return true;
+        };
+    // Frames of any alignment to the ring
+    for ( size_t i = 0; i < 2 * k_ring / k_frame; ++i ) {
+        Line::receive( k_frame );
+        Line::idle( );
+        TEST_ASSERT_TRUE( g_uart.consume( check ) );
+        first = static_cast< uint8_t >( first + k_frame );
+    }
+    TEST_ASSERT_EQUAL( 2 * k_ring / k_frame, calls );
+    TEST_ASSERT_EQUAL( 0, g_uart.overruns( ) );
+}
+
+void test_overrun_counted_and_recovers() {
+    uint8_t buffer[ k_ring ];
+    Line::receive( k_ring + 10 );
+    Line::idle( );
+    TEST_ASSERT_EQUAL( 0, g_uart.available( ) );
+    TEST_ASSERT_EQUAL( 1, g_uart.overruns( ) );
+    Line::receive( 5 );
+    Line::idle( );
+    TEST_ASSERT_EQUAL( 5, g_uart.read( buffer, sizeof( buffer ) ) );
+    assertSequence( buffer, 5, static_cast< uint8_t >( k_ring + 10 ) );
+}
+
+void test_overwritten_while_consuming() {
+    Line::receive( k_frame );
+    Line::idle( );
+    const bool result = g_uart.consume( [](const uint8_t *, size_t) {
+            // Main loop is late, DMA laps the ring meanwhile
+            Line::receive( k_ring );
+            return true;
+        } );
+    TEST_ASSERT_FALSE( result );
+    TEST_ASSERT_EQUAL( 1, g_uart.overruns( ) );
+}
+
+void test_readBytes_any_length() {
+    uint8_t buffer[ k_ring ];
+    TEST_ASSERT_EQUAL( 0, g_uart.readBytes( buffer, k_ring ) );
+    Line::receive( 3 );
+    Line::idle( );
+    TEST_ASSERT_EQUAL( 3, g_uart.readBytes( buffer, 3 ) );
+    assertSequence( buffer, 3, 0 );
+}
@@ -0,0 +1,92 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_begin_setup();
+extern void test_idle_publishes_short_message();
+extern void test_half_and_complete_without_idle();
+extern void test_message_across_ring_end();
+extern void test_consume_contiguous_and_wrapped();
+extern void test_overrun_counted_and_recovers();
+extern void test_overwritten_while_consuming();
+extern void test_readBytes_any_length();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/native/test_UartRx/test.cpp");
+  run_test(test_begin_setup, "test_begin_setup", 48);
+  run_test(test_idle_publishes_short_message, "test_idle_publishes_short_message", 56);
+  run_test(test_half_and_complete_without_idle, "test_half_and_complete_without_idle", 68);
+  run_test(test_message_across_ring_end, "test_message_across_ring_end", 80);
+  run_test(test_consume_contiguous_and_wrapped, "test_consume_contiguous_and_wrapped", 91);
+  run_test(test_overrun_counted_and_recovers, "test_overrun_counted_and_recovers", 111);
+  run_test(test_overwritten_while_consuming, "test_overwritten_while_consuming", 123);
+  run_test(test_readBytes_any_length, "test_readBytes_any_length", 135);
+
+  return UnityEnd();
+}
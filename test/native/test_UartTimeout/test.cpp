@@ -0,0 +1,138 @@
+// test/native/test_UartTimeout/test.cpp - non-blocking and timeout-aware reception of HardwareUART against host models
+#include <unity.h>
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Line.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+using RxDma = Model::Dma< 3 >;
+using TxDma = Model::Dma< 2 >;
+using Uart = Device::HardwareUARTTpl< Model::Usart, RxDma, TxDma, Model::Clock >;
+using Line = Model::Line< Uart, RxDma, TxDma >;
+constexpr size_t k_frame = sizeof( Uart::Buffer );
+
+static Uart g_uart;
+
+void setUp() {
+    Line::clear( );
+    g_uart.begin( 115200 );
+    g_uart.onReceive( nullptr, nullptr, 0, nullptr );
+}
+void tearDown() {}
+
+// A frame arrives while the caller sleeps the third millisecond
+static void frameAtThird() {
+    if ( 3 == Model::Clock::s_now )
+        Line::message( k_frame );
+}
+
+struct Events {
+    size_t frames = 0;
+    size_t length = 0;
+    size_t silences = 0;
+};
+static void onFrame(const uint8_t *, size_t length, void *context) {
+    Events *events = static_cast< Events *>( context );
+    ++events ->frames;
+    events ->length = length;
+}
+static void onSilence(void *context) {
+    ++static_cast< Events *>( context ) ->silences;
+}
+
+void test_tryRead_never_waits() {
+    uint8_t buffer[ k_frame ];
+    TEST_ASSERT_FALSE( g_uart.tryRead( buffer, 3 ) );
+    Line::message( 2 );
+    // Exact length or nothing, the bytes stay
+    TEST_ASSERT_FALSE( g_uart.tryRead( buffer, 3 ) );
+    TEST_ASSERT_EQUAL( 2, g_uart.available( ) );
+    Line::message( 1 );
+    TEST_ASSERT_TRUE( g_uart.tryRead( buffer, 3 ) );
+    TEST_ASSERT_EQUAL_HEX8( 2, buffer[ 2 ] );
+    TEST_ASSERT_FALSE( g_uart.tryConsume( [](const uint8_t *, size_t) { return true; } ) );
+    TEST_ASSERT_EQUAL( 0, Model::Clock::s_idles );
+}
+
+void test_readFor_times_out() {
+    uint8_t buffer[ k_frame ];
+    TEST_ASSERT_EQUAL( 0, g_uart.readFor( buffer, k_frame, 10 ) );
+    TEST_ASSERT_EQUAL( 10, Model::Clock::s_now );
+    // Nothing lost on timeout, a short message is still there
+    Line::message( 4 );
+    TEST_ASSERT_EQUAL( 0, g_uart.readFor( buffer, k_frame, 5 ) );
+    TEST_ASSERT_EQUAL( 4, g_uart.available( ) );
+}
+
+void test_readFor_sleeps_until_data() {
+    uint8_t buffer[ k_frame ];
+    Model::Clock::s_onIdle = &frameAtThird;
+    TEST_ASSERT_EQUAL( k_frame, g_uart.readFor( buffer, k_frame, 10 ) );
+    TEST_ASSERT_EQUAL( 3, Model::Clock::s_idles );
+    TEST_ASSERT_EQUAL_HEX8( k_frame - 1, buffer[ k_frame - 1 ] );
+}
+
+void test_consumeFor() {
+    TEST_ASSERT_FALSE( g_uart.consumeFor( [](const uint8_t *, size_t) { return true; }, 2 ) );
+    Model::Clock::s_onIdle = &frameAtThird;
+    size_t length = 0;
+    TEST_ASSERT_TRUE( g_uart.consumeFor( [&length](const uint8_t *, size_t size) {
+            length = size;
+            return true;
+        }, 5 ) );
+    TEST_ASSERT_EQUAL( k_frame, length );
+}
+
+void test_poll_dispatches_frames() {
+    Events events;
+    g_uart.onReceive( &onFrame, &onSilence, 100, &events );
+    TEST_ASSERT_EQUAL( 0, g_uart.poll( ) );
+    Line::message( 2 * k_frame + 1 );
+    TEST_ASSERT_EQUAL( 2, g_uart.poll( ) );
+    TEST_ASSERT_EQUAL( 2, events.frames );
+    TEST_ASSERT_EQUAL( k_frame, events.length );
+    // Partial frame waits for the rest
+    TEST_ASSERT_EQUAL( 1, g_uart.available( ) );
+    TEST_ASSERT_EQUAL( 0, events.silences );
+}
+
+// DMA laps the ring while the handler works on the frame
+static void onFrameLapped(const uint8_t *frame, size_t length, void *context) {
+    Line::s_next = 0x55;
+    Line::receive( Uart::k_RxBufferSize );
+    memcpy( static_cast< uint8_t *>( context ), frame, length );
+}
+
+void test_poll_hands_over_intact_frame() {
+    uint8_t seen[ k_frame ] = { };
+    g_uart.onReceive( &onFrameLapped, nullptr, 0, seen );
+    Line::message( k_frame );
+    TEST_ASSERT_EQUAL( 1, g_uart.poll( ) );
+    // The handler saw the bytes as they arrived, not what DMA wrote over them
+    for ( size_t i = 0; i < k_frame; ++i )
+        TEST_ASSERT_EQUAL_HEX8( i, seen[ i ] );
+}
+
+void test_poll_reports_silence_once_per_timeout() {
+    Events events;
+    g_uart.onReceive( &onFrame, &onSilence, 100, &events );
+    Model::Clock::s_now = 99;
+    g_uart.poll( );
+    TEST_ASSERT_EQUAL( 0, events.silences );
+    Model::Clock::s_now = 100;
+    g_uart.poll( );
+    g_uart.poll( );
+    TEST_ASSERT_EQUAL( 1, events.silences );
+    // A frame restarts the period
+    Model::Clock::s_now = 150;
+    Line::message( k_frame );
+    g_uart.poll( );
+    Model::Clock::s_now = 249;
+    g_uart.poll( );
+    TEST_ASSERT_EQUAL( 1, events.silences );
+    Model::Clock::s_now = 250;
+    g_uart.poll( );
+    TEST_ASSERT_EQUAL( 2, events.silences );
+    TEST_ASSERT_EQUAL( 0, Model::Clock::s_idles );
+}
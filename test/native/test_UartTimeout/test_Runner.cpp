@@ -0,0 +1,91 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Line.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_tryRead_never_waits();
+extern void test_readFor_times_out();
+extern void test_readFor_sleeps_until_data();
+extern void test_consumeFor();
+extern void test_poll_dispatches_frames();
+extern void test_poll_hands_over_intact_frame();
+extern void test_poll_reports_silence_once_per_timeout();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/native/test_UartTimeout/test.cpp");
+  run_test(test_tryRead_never_waits, "test_tryRead_never_waits", 44);
+  run_test(test_readFor_times_out, "test_readFor_times_out", 58);
+  run_test(test_readFor_sleeps_until_data, "test_readFor_sleeps_until_data", 68);
+  run_test(test_consumeFor, "test_consumeFor", 76);
+  run_test(test_poll_dispatches_frames, "test_poll_dispatches_frames", 87);
+  run_test(test_poll_hands_over_intact_frame, "test_poll_hands_over_intact_frame", 107);
+  run_test(test_poll_reports_silence_once_per_timeout, "test_poll_reports_silence_once_per_timeout", 117);
+
+  return UnityEnd();
+}
@@ -0,0 +1,139 @@
+// test/native/test_UartTx/test.cpp - TX queue of HardwareUART against host register models
+#include <unity.h>
+#include <vector>
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Line.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+using RxDma = Model::Dma< 3 >;
+using TxDma = Model::Dma< 2 >;
+using Uart = Device::HardwareUARTTpl< Model::Usart, RxDma, TxDma, Model::Clock >;
+using Line = Model::Line< Uart, RxDma, TxDma >;
+constexpr size_t k_queue = Uart::k_TxQueueSize;
+
+static Uart g_uart;
+
+void setUp() {
+    Line::clear( );
+    g_uart.begin( 115200 );
+}
+void tearDown() {}
+
+// Software-raised interrupt is taken
+static bool kick() {
+    if ( !TxDma::pending( ) )
+        return false;
+    Uart::txIsr( );
+    return true;
+}
+
+// Lets TX DMA run until the queue is empty
+static void drain() {
+    kick( );
+    while ( TxDma::s_enabled )
+        if ( TxDma::transfer( k_queue ) )
+            Uart::txIsr( );
+}
+
+static std::vector< uint8_t > sequence(size_t size, uint8_t first) {
+    std::vector< uint8_t > data( size );
+    for ( size_t i = 0; i < size; ++i )
+        data[ i ] = static_cast< uint8_t >( first + i );
+    return data;
+}
+
+void test_write_returns_before_sending() {
+    const auto data = sequence( 10, 0 );
+    TEST_ASSERT_EQUAL( data.size( ), g_uart.write( data.data( ), data.size( ) ) );
+    TEST_ASSERT_TRUE( Model::Usart::s_wire.empty( ) );
+    TEST_ASSERT_FALSE( TxDma::s_enabled );
+    // DMA is started from the interrupt only
+    TEST_ASSERT_TRUE( kick( ) );
+    TEST_ASSERT_TRUE( TxDma::s_enabled );
+    TEST_ASSERT_EQUAL( Model::Usart::dataAddress( ), TxDma::s_to );
+    TEST_ASSERT_EQUAL( data.size( ), TxDma::s_count );
+    drain( );
+    TEST_ASSERT_TRUE( data == Model::Usart::s_wire );
+    TEST_ASSERT_EQUAL( k_queue, g_uart.availableForWrite( ) );
+}
+
+void test_order_while_busy() {
+    std::vector< uint8_t > expected;
+    for ( uint8_t i = 0; i < 3; ++i ) {
+        const auto data = sequence( 20, i * 20 );
+        TEST_ASSERT_EQUAL( data.size( ), g_uart.write( data.data( ), data.size( ) ) );
+        expected.insert( expected.end( ), data.begin( ), data.end( ) );
+        // First message goes out, the rest wait for its completion
+        kick( );
+        TxDma::transfer( 5 );
+    }
+    TEST_ASSERT_EQUAL( 1, TxDma::s_starts );
+    g_uart.write( 'Z' );
+    expected.push_back( 'Z' );
+    drain( );
+    TEST_ASSERT_TRUE( expected == Model::Usart::s_wire );
+}
+
+void test_wrap_around_queue_end() {
+    const auto first = sequence( k_queue - 10, 0 );
+    g_uart.write( first.data( ), first.size( ) );
+    drain( );
+    const auto second = sequence( 30, 100 );
+    g_uart.write( second.data( ), second.size( ) );
+    drain( );
+    // Two pieces: up to the end of the queue and from its start
+    TEST_ASSERT_EQUAL( 3, TxDma::s_starts );
+    TEST_ASSERT_EQUAL( first.size( ) + second.size( ), Model::Usart::s_wire.size( ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( second.data( ), Model::Usart::s_wire.data( ) + first.size( ), second.size( ) );
+}
+
+void test_overflow_back_pressure() {
+    const auto data = sequence( 100, 0 );
+    TEST_ASSERT_EQUAL( 100, g_uart.write( data.data( ), 100 ) );
+    TEST_ASSERT_EQUAL( 100, g_uart.write( data.data( ), 100 ) );
+    // Whole message or nothing
+    TEST_ASSERT_EQUAL( 0, g_uart.write( data.data( ), 100 ) );
+    TEST_ASSERT_EQUAL( k_queue - 200, g_uart.availableForWrite( ) );
+    TEST_ASSERT_EQUAL( k_queue - 200, g_uart.write( data.data( ), k_queue - 200 ) );
+    TEST_ASSERT_EQUAL( 0, g_uart.write( 'X' ) );
+    // Room again once the queue is handed over to the USART
+    drain( );
+    TEST_ASSERT_EQUAL( k_queue, g_uart.availableForWrite( ) );
+    TEST_ASSERT_EQUAL( 100, g_uart.write( data.data( ), 100 ) );
+    drain( );
+    TEST_ASSERT_EQUAL( k_queue + 100, Model::Usart::s_wire.size( ) );
+}
+
+void test_transfer_error_drops_piece() {
+    const auto data = sequence( 40, 0 );
+    g_uart.write( data.data( ), 20 );
+    kick( );
+    g_uart.write( data.data( ) + 20, 20 );
+    TxDma::transfer( 5 );
+    TxDma::fault( );
+    Uart::txIsr( );
+    drain( );
+    // Sending goes on with the next message
+    TEST_ASSERT_EQUAL( 25, Model::Usart::s_wire.size( ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( data.data( ) + 20, Model::Usart::s_wire.data( ) + 5, 20 );
+}
+
+void test_writev_one_transfer() {
+    const auto header = sequence( 3, 0 ), payload = sequence( 50, 3 ), hash = sequence( 1, 53 );
+    const Tool::Segment segments[] = { { header.data( ), header.size( ) }, { payload.data( ), payload.size( ) }, { hash.data( ), hash.size( ) } };
+    TEST_ASSERT_EQUAL( 54, g_uart.writev( segments, 3 ) );
+    kick( );
+    // Queued back-to-back, DMA takes the whole message at once
+    TEST_ASSERT_EQUAL( 54, TxDma::s_count );
+    drain( );
+    TEST_ASSERT_EQUAL( 1, TxDma::s_starts );
+    TEST_ASSERT_TRUE( sequence( 54, 0 ) == Model::Usart::s_wire );
+
+    // Whole message or nothing
+    const auto big = sequence( k_queue - 10, 0 );
+    TEST_ASSERT_EQUAL( big.size( ), g_uart.write( big.data( ), big.size( ) ) );
+    TEST_ASSERT_EQUAL( 0, g_uart.writev( segments, 3 ) );
+    TEST_ASSERT_EQUAL( 10, g_uart.availableForWrite( ) );
+}
@@ -0,0 +1,88 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "../Model/Clock.h"
+#include "../Model/Dma.h"
+#include "../Model/Usart.h"
+#include "Device/HardwareUART.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_write_returns_before_sending();
+extern void test_order_while_busy();
+extern void test_wrap_around_queue_end();
+extern void test_overflow_back_pressure();
+extern void test_transfer_error_drops_piece();
+extern void test_writev_one_transfer();
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test/native/test_UartTx/test.cpp");
+  run_test(test_write_returns_before_sending, "test_write_returns_before_sending", 48);
+  run_test(test_order_while_busy, "test_order_while_busy", 63);
+  run_test(test_wrap_around_queue_end, "test_wrap_around_queue_end", 80);
+  run_test(test_overflow_back_pressure, "test_overflow_back_pressure", 93);
+  run_test(test_transfer_error_drops_piece, "test_transfer_error_drops_piece", 110);
+  run_test(test_writev_one_transfer, "test_writev_one_transfer", 124);
+
+  return UnityEnd();
+}